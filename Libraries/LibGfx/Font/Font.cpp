@@ -12,6 +12,7 @@
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/TypefaceSkia.h>
 #include <LibGfx/TextLayout.h>
+#include <LibGfx/TextShapingCache.h>
 
 #include <core/SkFont.h>
 #include <core/SkFontMetrics.h>
@@ -96,6 +97,7 @@ float Font::point_size() const
 
 Font::~Font()
 {
+    TextShapingCache::the().evict_entries_for_font(*this);
     if (m_harfbuzz_font)
         hb_font_destroy(m_harfbuzz_font);
 }
@@ -140,25 +142,6 @@ SkFont Font::skia_font(float scale) const
     return sk_font;
 }
 
-Font::ShapingCache::~ShapingCache()
-{
-    clear();
-}
-
-void Font::ShapingCache::clear()
-{
-    for (auto& it : map) {
-        hb_buffer_destroy(it.value);
-    }
-    map.clear();
-    for (auto& buffer : single_ascii_character_map) {
-        if (buffer) {
-            hb_buffer_destroy(buffer);
-            buffer = nullptr;
-        }
-    }
-}
-
 static bool hb_face_has_table(hb_face_t* face, hb_tag_t tag)
 {
     hb_blob_t* blob = hb_face_reference_table(face, tag);
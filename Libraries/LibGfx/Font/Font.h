@@ -83,26 +83,12 @@ public:
     Font const& bold_variant() const;
     hb_font_t* harfbuzz_font() const;
 
-    struct ShapingCache {
-        // Before using the cache, make sure the features match! If they don't, clear the cache.
-        ShapeFeatures features;
-
-        HashMap<Utf16String, hb_buffer_t*> map;
-        hb_buffer_t* single_ascii_character_map[128] { nullptr };
-
-        ~ShapingCache();
-        void clear();
-    };
-    ShapingCache& shaping_cache() const { return m_shaping_cache; }
-
     bool is_emoji_font() const;
 
 private:
     mutable RefPtr<Font const> m_bold_variant;
     mutable hb_font_t* m_harfbuzz_font { nullptr };
 
-    mutable ShapingCache m_shaping_cache;
-
     mutable TriState m_is_emoji_font { TriState::Unknown };
 
     NonnullRefPtr<Typeface const> m_typeface;
@@ -9,6 +9,7 @@
 #include <LibGfx/SkiaUtils.h>
 
 #include <core/SkColorSpace.h>
+#include <core/SkPixmap.h>
 #include <core/SkSurface.h>
 #include <gpu/GrBackendSurface.h>
 #include <gpu/GrDirectContext.h>
@@ -155,6 +156,27 @@ PaintingSurface::~PaintingSurface()
     unlock_context();
 }
 
+RefPtr<PaintingSurface> PaintingSurface::create_view_of_rect(IntRect const& rect)
+{
+    if (m_impl->context)
+        return nullptr;
+
+    SkPixmap pixmap;
+    if (!m_impl->surface->peekPixels(&pixmap))
+        return nullptr;
+
+    SkPixmap subset;
+    if (!pixmap.extractSubset(&subset, SkIRect::MakeXYWH(rect.x(), rect.y(), rect.width(), rect.height())))
+        return nullptr;
+
+    auto surface = SkSurfaces::WrapPixels(subset.info(), subset.writable_addr(), subset.rowBytes());
+    if (!surface)
+        return nullptr;
+
+    // NOTE: The view keeps our bitmap alive, since it paints into its pixels.
+    return adopt_ref(*new PaintingSurface(make<Impl>(RefPtr<SkiaBackendContext> {}, IntSize { subset.width(), subset.height() }, surface, m_impl->bitmap)));
+}
+
 void PaintingSurface::read_into_bitmap(Bitmap& bitmap)
 {
     auto color_type = to_skia_color_type(bitmap.format());
@@ -43,6 +43,10 @@ public:
     static NonnullRefPtr<PaintingSurface> create_from_vkimage(NonnullRefPtr<SkiaBackendContext> context, NonnullRefPtr<VulkanImage> vulkan_image, Origin origin);
 #endif
 
+    // Returns a surface that paints directly into the given rect of this one, e.g. so that several threads can paint
+    // different parts of it at once. Only surfaces backed by memory are supported, for others nothing is returned.
+    RefPtr<PaintingSurface> create_view_of_rect(IntRect const&);
+
     void read_into_bitmap(Bitmap&);
     void write_from_bitmap(Bitmap const&);
 
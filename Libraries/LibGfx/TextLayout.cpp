@@ -11,7 +11,7 @@
 #include <AK/Utf16View.h>
 #include <LibGfx/Point.h>
 #include <LibGfx/TextLayout.h>
-#include <harfbuzz/hb.h>
+#include <LibGfx/TextShapingCache.h>
 
 namespace Gfx {
 
@@ -67,75 +67,12 @@ Vector<NonnullRefPtr<GlyphRun>> shape_text(FloatPoint baseline_start, Utf16View
     return runs;
 }
 
-static hb_buffer_t* setup_text_shaping(Utf16View const& string, Font const& font, ShapeFeatures const& features)
-{
-    hb_buffer_t* buffer = hb_buffer_create();
-
-    if (string.has_ascii_storage())
-        hb_buffer_add_utf8(buffer, string.ascii_span().data(), string.length_in_code_units(), 0, -1);
-    else
-        hb_buffer_add_utf16(buffer, reinterpret_cast<u16 const*>(string.utf16_span().data()), string.length_in_code_units(), 0, -1);
-
-    hb_buffer_guess_segment_properties(buffer);
-
-    auto* hb_font = font.harfbuzz_font();
-    hb_feature_t const* hb_features_data = nullptr;
-    Vector<hb_feature_t, 4> hb_features;
-    if (!features.is_empty()) {
-        hb_features.ensure_capacity(features.size());
-        for (auto const& feature : features) {
-            hb_features.unchecked_append({
-                .tag = HB_TAG(feature.tag[0], feature.tag[1], feature.tag[2], feature.tag[3]),
-                .value = feature.value,
-                .start = 0,
-                .end = HB_FEATURE_GLOBAL_END,
-            });
-        }
-        hb_features_data = hb_features.data();
-    }
-
-    hb_shape(hb_font, buffer, hb_features_data, features.size());
-
-    return buffer;
-}
-
 NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf16View const& string, Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
 {
     auto const& metrics = font.pixel_metrics();
-    auto& shaping_cache = font.shaping_cache();
-
-    // NOTE: We only cache shaping results for a specific set of features. If the features change, we clear the cache.
-    if (shaping_cache.features != features) {
-        shaping_cache.clear();
-        shaping_cache.features = features;
-    }
-
-    // FIXME: The cache currently grows unbounded. We should have some limit and LRU mechanism.
-    auto get_or_create_buffer = [&] -> hb_buffer_t* {
-        if (string.length_in_code_units() == 1) {
-            auto code_unit = string.code_unit_at(0);
-            if (code_unit < 128) {
-                auto*& cache_slot = shaping_cache.single_ascii_character_map[code_unit];
-                if (!cache_slot) {
-                    cache_slot = setup_text_shaping(string, font, features);
-                }
-                return cache_slot;
-            }
-        }
-        if (auto it = shaping_cache.map.find(
-                string.hash(), [&](auto& candidate) { return candidate.key == string; });
-            it != shaping_cache.map.end()) {
-            return it->value;
-        }
-        auto* buffer = setup_text_shaping(string, font, features);
-        shaping_cache.map.set(Utf16String::from_utf16(string), buffer);
-        return buffer;
-    };
-
-    hb_buffer_t* buffer = get_or_create_buffer();
-    u32 glyph_count;
-    auto const* glyph_info = hb_buffer_get_glyph_infos(buffer, &glyph_count);
-    auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
+    auto shaped_text = TextShapingCache::the().shape(string, font, features);
+    auto const& glyphs = shaped_text->glyphs();
+    auto glyph_count = glyphs.size();
 
     Vector<DrawGlyph> glyph_run;
     glyph_run.ensure_capacity(glyph_count);
@@ -148,10 +85,10 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
     // A single grapheme may be represented by multiple glyphs, where any of those glyphs are zero-width. We want to
     // assign code unit lengths such that each glyph knows the length of the text it respresents.
     auto glyph_length_in_code_units = [&](auto index) -> size_t {
-        auto starting_offset = glyph_info[index].cluster;
+        auto starting_offset = glyphs[index].cluster;
 
         for (size_t i = index + 1; i < glyph_count; ++i) {
-            if (auto offset = glyph_info[i].cluster; offset != starting_offset)
+            if (auto offset = glyphs[i].cluster; offset != starting_offset)
                 return offset - starting_offset;
         }
 
@@ -161,16 +98,16 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
     for (size_t i = 0; i < glyph_count; ++i) {
         auto position = point
             - FloatPoint { 0, metrics.ascent }
-            + FloatPoint { positions[i].x_offset, positions[i].y_offset } / text_shaping_resolution;
+            + FloatPoint { glyphs[i].x_offset, glyphs[i].y_offset } / text_shaping_resolution;
 
         glyph_run.unchecked_append({
             .position = position,
             .length_in_code_units = glyph_length_in_code_units(i),
-            .glyph_width = positions[i].x_advance / text_shaping_resolution,
-            .glyph_id = glyph_info[i].codepoint,
+            .glyph_width = glyphs[i].x_advance / text_shaping_resolution,
+            .glyph_id = glyphs[i].glyph_id,
         });
 
-        point += FloatPoint { positions[i].x_advance, positions[i].y_advance } / text_shaping_resolution;
+        point += FloatPoint { glyphs[i].x_advance, glyphs[i].y_advance } / text_shaping_resolution;
 
         // NOTE: The spec says that we "really should not" apply letter-spacing to the trailing edge of a line but
         //       other browsers do so we will as well. https://drafts.csswg.org/css-text/#example-7880704e
@@ -182,17 +119,7 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
 
 float measure_text_width(Utf16View const& string, Font const& font, ShapeFeatures const& features)
 {
-    auto* buffer = setup_text_shaping(string, font, features);
-
-    u32 glyph_count;
-    auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
-
-    hb_position_t point_x = 0;
-    for (size_t i = 0; i < glyph_count; ++i)
-        point_x += positions[i].x_advance;
-
-    hb_buffer_destroy(buffer);
-    return point_x / text_shaping_resolution;
+    return TextShapingCache::the().shape(string, font, features)->width();
 }
 
 }
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashFunctions.h>
+#include <LibGfx/Font/Font.h>
+#include <LibGfx/TextShapingCache.h>
+#include <harfbuzz/hb.h>
+
+namespace Gfx {
+
+TextShapingCache& TextShapingCache::the()
+{
+    static TextShapingCache* s_the = new TextShapingCache;
+    return *s_the;
+}
+
+float TextShapingCache::ShapedText::width() const
+{
+    return static_cast<float>(m_x_advance) / text_shaping_resolution;
+}
+
+static unsigned hash_for(Utf16View const& text, Font const& font, ShapeFeatures const& features)
+{
+    auto hash = pair_int_hash(ptr_hash(&font), text.hash());
+    for (auto const& feature : features) {
+        u32 tag = (static_cast<u8>(feature.tag[0]) << 24) | (static_cast<u8>(feature.tag[1]) << 16) | (static_cast<u8>(feature.tag[2]) << 8) | static_cast<u8>(feature.tag[3]);
+        hash = pair_int_hash(hash, pair_int_hash(tag, feature.value));
+    }
+    return hash;
+}
+
+static NonnullRefPtr<TextShapingCache::ShapedText const> shape_with_harfbuzz(Utf16View const& string, Font const& font, ShapeFeatures const& features)
+{
+    hb_buffer_t* buffer = hb_buffer_create();
+
+    if (string.has_ascii_storage())
+        hb_buffer_add_utf8(buffer, string.ascii_span().data(), string.length_in_code_units(), 0, -1);
+    else
+        hb_buffer_add_utf16(buffer, reinterpret_cast<u16 const*>(string.utf16_span().data()), string.length_in_code_units(), 0, -1);
+
+    hb_buffer_guess_segment_properties(buffer);
+
+    auto* hb_font = font.harfbuzz_font();
+    hb_feature_t const* hb_features_data = nullptr;
+    Vector<hb_feature_t, 4> hb_features;
+    if (!features.is_empty()) {
+        hb_features.ensure_capacity(features.size());
+        for (auto const& feature : features) {
+            hb_features.unchecked_append({
+                .tag = HB_TAG(feature.tag[0], feature.tag[1], feature.tag[2], feature.tag[3]),
+                .value = feature.value,
+                .start = 0,
+                .end = HB_FEATURE_GLOBAL_END,
+            });
+        }
+        hb_features_data = hb_features.data();
+    }
+
+    hb_shape(hb_font, buffer, hb_features_data, features.size());
+
+    u32 glyph_count;
+    auto const* glyph_info = hb_buffer_get_glyph_infos(buffer, &glyph_count);
+    auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
+
+    // NOTE: We only keep what we need from the HarfBuzz buffer, which is a fraction of its size.
+    Vector<TextShapingCache::Glyph> glyphs;
+    glyphs.ensure_capacity(glyph_count);
+    i64 x_advance = 0;
+    for (size_t i = 0; i < glyph_count; ++i) {
+        glyphs.unchecked_append({
+            .glyph_id = glyph_info[i].codepoint,
+            .cluster = glyph_info[i].cluster,
+            .x_advance = positions[i].x_advance,
+            .y_advance = positions[i].y_advance,
+            .x_offset = positions[i].x_offset,
+            .y_offset = positions[i].y_offset,
+        });
+        x_advance += positions[i].x_advance;
+    }
+
+    hb_buffer_destroy(buffer);
+    return adopt_ref(*new TextShapingCache::ShapedText(move(glyphs), x_advance));
+}
+
+NonnullRefPtr<TextShapingCache::ShapedText const> TextShapingCache::shape(Utf16View const& text, Font const& font, ShapeFeatures const& features)
+{
+    auto hash = hash_for(text, font, features);
+
+    {
+        Threading::MutexLocker locker(m_mutex);
+        auto it = m_entries.find(hash, [&](auto const& entry) {
+            return entry->font == &font && entry->features == features && entry->text == text;
+        });
+        if (it != m_entries.end()) {
+            auto& entry = **it;
+            m_recently_used.remove(entry);
+            m_recently_used.append(entry);
+            ++m_hits;
+            return entry.shaped_text;
+        }
+        ++m_misses;
+    }
+
+    // NOTE: Shaping happens without holding the lock. If another thread shapes the same text in the meantime, we
+    //       simply end up with the same result twice and keep the one that was inserted first.
+    auto shaped_text = shape_with_harfbuzz(text, font, features);
+
+    auto entry = adopt_own(*new Entry {
+        .font = &font,
+        .features = features,
+        .text = Utf16String::from_utf16(text),
+        .hash = hash,
+        .shaped_text = shaped_text,
+    });
+    entry->byte_size = sizeof(Entry)
+        + sizeof(ShapedText)
+        + shaped_text->glyphs().size() * sizeof(Glyph)
+        + text.length_in_code_units() * sizeof(char16_t)
+        + features.size() * sizeof(ShapeFeature);
+
+    Threading::MutexLocker locker(m_mutex);
+    auto it = m_entries.find(hash, [&](auto const& existing_entry) {
+        return existing_entry->font == &font && existing_entry->features == features && existing_entry->text == text;
+    });
+    if (it != m_entries.end())
+        return (*it)->shaped_text;
+
+    m_byte_size += entry->byte_size;
+    m_recently_used.append(*entry);
+    m_entries.set(move(entry));
+    evict_entries_over_budget();
+    return shaped_text;
+}
+
+void TextShapingCache::evict_entry(Entry& entry)
+{
+    m_recently_used.remove(entry);
+    m_byte_size -= entry.byte_size;
+    auto it = m_entries.find(entry.hash, [&](auto const& candidate) { return candidate.ptr() == &entry; });
+    VERIFY(it != m_entries.end());
+    m_entries.remove(it);
+}
+
+void TextShapingCache::evict_entries_over_budget()
+{
+    while (m_byte_size > m_byte_budget && !m_recently_used.is_empty()) {
+        evict_entry(*m_recently_used.first());
+        ++m_evictions;
+    }
+}
+
+TextShapingCache::Statistics TextShapingCache::statistics() const
+{
+    Threading::MutexLocker locker(m_mutex);
+    return {
+        .hits = m_hits,
+        .misses = m_misses,
+        .evictions = m_evictions,
+        .entry_count = m_entries.size(),
+        .byte_size = m_byte_size,
+        .byte_budget = m_byte_budget,
+    };
+}
+
+void TextShapingCache::reset_statistics()
+{
+    Threading::MutexLocker locker(m_mutex);
+    m_hits = 0;
+    m_misses = 0;
+    m_evictions = 0;
+}
+
+void TextShapingCache::set_byte_budget(size_t byte_budget)
+{
+    Threading::MutexLocker locker(m_mutex);
+    m_byte_budget = byte_budget;
+    evict_entries_over_budget();
+}
+
+void TextShapingCache::evict_entries_for_font(Font const& font)
+{
+    Threading::MutexLocker locker(m_mutex);
+    m_entries.remove_all_matching([&](auto const& entry) {
+        if (entry->font != &font)
+            return false;
+        m_recently_used.remove(*entry);
+        m_byte_size -= entry->byte_size;
+        return true;
+    });
+}
+
+void TextShapingCache::clear()
+{
+    Threading::MutexLocker locker(m_mutex);
+    m_recently_used.clear();
+    m_entries.clear();
+    m_byte_size = 0;
+}
+
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/HashTable.h>
+#include <AK/IntrusiveList.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Utf16String.h>
+#include <AK/Vector.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/ShapeFeature.h>
+#include <LibThreading/Mutex.h>
+
+namespace Gfx {
+
+// A process-wide cache of text shaping results, shared by every document and canvas that shapes text with the same
+// fonts. Results are keyed by font, font features and text. Once the cache holds more than its byte budget, the least
+// recently used results are evicted.
+class TextShapingCache {
+    AK_MAKE_NONCOPYABLE(TextShapingCache);
+    AK_MAKE_NONMOVABLE(TextShapingCache);
+
+public:
+    static TextShapingCache& the();
+
+    // All positions are in HarfBuzz units, i.e. text_shaping_resolution units per pixel.
+    struct Glyph {
+        u32 glyph_id { 0 };
+        u32 cluster { 0 };
+        i32 x_advance { 0 };
+        i32 y_advance { 0 };
+        i32 x_offset { 0 };
+        i32 y_offset { 0 };
+    };
+
+    class ShapedText : public AtomicRefCounted<ShapedText> {
+    public:
+        ShapedText(Vector<Glyph>&& glyphs, i64 x_advance)
+            : m_glyphs(move(glyphs))
+            , m_x_advance(x_advance)
+        {
+        }
+
+        Vector<Glyph> const& glyphs() const { return m_glyphs; }
+
+        // The sum of the horizontal advances of all glyphs, in pixels.
+        float width() const;
+
+    private:
+        Vector<Glyph> m_glyphs;
+        i64 m_x_advance { 0 };
+    };
+
+    struct Statistics {
+        u64 hits { 0 };
+        u64 misses { 0 };
+        u64 evictions { 0 };
+        size_t entry_count { 0 };
+        size_t byte_size { 0 };
+        size_t byte_budget { 0 };
+    };
+
+    NonnullRefPtr<ShapedText const> shape(Utf16View const&, Font const&, ShapeFeatures const&);
+
+    Statistics statistics() const;
+    void reset_statistics();
+
+    void set_byte_budget(size_t);
+
+    // Must be called before a font goes away, since the cache only refers to fonts by address.
+    void evict_entries_for_font(Font const&);
+
+    void clear();
+
+private:
+    TextShapingCache() = default;
+
+    static constexpr size_t default_byte_budget = 8 * MiB;
+
+    struct Entry {
+        Font const* font { nullptr };
+        ShapeFeatures features;
+        Utf16String text;
+        unsigned hash { 0 };
+        NonnullRefPtr<ShapedText const> shaped_text;
+        size_t byte_size { 0 };
+        IntrusiveListNode<Entry> list_node;
+    };
+
+    struct EntryTraits : public DefaultTraits<NonnullOwnPtr<Entry>> {
+        static unsigned hash(NonnullOwnPtr<Entry> const& entry) { return entry->hash; }
+        static bool equals(NonnullOwnPtr<Entry> const& a, NonnullOwnPtr<Entry> const& b) { return a.ptr() == b.ptr(); }
+    };
+
+    void evict_entry(Entry&);
+    void evict_entries_over_budget();
+
+    HashTable<NonnullOwnPtr<Entry>, EntryTraits> m_entries;
+
+    // Ordered from least to most recently used.
+    IntrusiveList<&Entry::list_node> m_recently_used;
+
+    size_t m_byte_size { 0 };
+    size_t m_byte_budget { default_byte_budget };
+    u64 m_hits { 0 };
+    u64 m_misses { 0 };
+    u64 m_evictions { 0 };
+
+    mutable Threading::Mutex m_mutex;
+};
+
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibRegex/RegexCompiledCompares.h>
+
+namespace regex {
+
+bool CompiledCompares::is_compilable(OpCode_Compare const& compare)
+{
+    for (auto const& argument : compare.flat_compares()) {
+        switch (argument.type) {
+        case CharacterCompareType::Undefined:
+        case CharacterCompareType::String:
+        case CharacterCompareType::Reference:
+        case CharacterCompareType::NamedReference:
+        case CharacterCompareType::RangeExpressionDummy:
+            // These either consume a variable number of characters or depend on earlier captures.
+            return false;
+        default:
+            break;
+        }
+    }
+    return true;
+}
+
+void CompiledCompares::prepare(ByteCode const& bytecode, MatchInput const& input)
+{
+    auto options = input.regex_options;
+    auto unicode = input.view.unicode();
+
+    auto index = m_compiled_for_options.find_first_index_if([&](auto const& compiled) {
+        return compiled.options.value() == options.value() && compiled.unicode == unicode;
+    });
+    if (!index.has_value()) {
+        if (m_compiled_for_options.size() == max_option_sets)
+            m_compiled_for_options.take_first();
+        m_compiled_for_options.append({ .options = options, .unicode = unicode, .execution_count = 0, .is_compiled = false, .table_indices = {}, .tables = {} });
+        index = m_compiled_for_options.size() - 1;
+    }
+
+    auto& compiled = m_compiled_for_options[*index];
+    if (!compiled.is_compiled && ++compiled.execution_count >= executions_before_compiling) {
+        compile(bytecode, input, compiled);
+        compiled.is_compiled = true;
+    }
+    m_current = &compiled;
+}
+
+void CompiledCompares::compile(ByteCode const& bytecode, MatchInput const& input, CompiledForOptions& compiled)
+{
+    auto bytecode_size = bytecode.size();
+    compiled.table_indices.resize_with_default_value(bytecode_size, -1);
+
+    // Every ASCII code point at the index of its own value.
+    static constexpr auto ascii_characters = [] {
+        Array<char, 128> characters {};
+        for (size_t i = 0; i < characters.size(); ++i)
+            characters[i] = static_cast<char>(i);
+        return characters;
+    }();
+
+    MatchInput scratch_input;
+    scratch_input.view = StringView { ascii_characters.data(), ascii_characters.size() };
+    scratch_input.view.set_unicode(compiled.unicode);
+    scratch_input.regex_options = input.regex_options;
+
+    auto state = MatchState::only_for_enumeration();
+    while (state.instruction_position < bytecode_size) {
+        auto& opcode = bytecode.get_opcode(state);
+        auto instruction_position = state.instruction_position;
+        auto next_position = instruction_position + opcode.size();
+
+        if (opcode.opcode_id() == OpCodeId::Compare && is_compilable(static_cast<OpCode_Compare const&>(opcode))) {
+            Array<u64, 2> table {};
+            auto scratch_state = MatchState::only_for_enumeration();
+            for (u32 code_point = 0; code_point < 128; ++code_point) {
+                scratch_state.instruction_position = instruction_position;
+                scratch_state.string_position = code_point;
+                scratch_state.string_position_in_code_units = code_point;
+
+                auto& compare = bytecode.get_opcode(scratch_state);
+                auto result = compare.execute(scratch_input, scratch_state);
+                if (result == ExecutionResult::Continue && scratch_state.string_position == code_point + 1)
+                    table[code_point / 64] |= 1ull << (code_point % 64);
+            }
+
+            compiled.table_indices[instruction_position] = static_cast<i32>(compiled.tables.size());
+            compiled.tables.append(table);
+        }
+
+        state.instruction_position = next_position;
+    }
+}
+
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include "RegexByteCode.h"
+#include "RegexMatch.h"
+#include "RegexOptions.h"
+
+#include <AK/Array.h>
+#include <AK/Optional.h>
+#include <AK/Types.h>
+#include <AK/Vector.h>
+
+namespace regex {
+
+// Compiles each single-character Compare instruction in the bytecode down to a 128-bit table of the ASCII
+// code points it accepts, so the VM can execute it with a single bit test instead of interpreting its list
+// of compare arguments. The tables are derived by running the instruction itself over every ASCII code point,
+// so they match the interpreter exactly for a given set of options; anything outside ASCII still goes through
+// the interpreter.
+// Compiling isn't free, so it only happens once a pattern has been matched often enough with the same options
+// for it to pay off. The tables are kept for each set of options they were compiled with.
+class REGEX_API CompiledCompares {
+public:
+    static constexpr size_t executions_before_compiling = 16;
+
+    // Counts a match with the given input's options, and compiles the bytecode for them once they are hot.
+    void prepare(ByteCode const&, MatchInput const&);
+
+    // Executes the Compare instruction at the current instruction position if it is compiled and the input
+    // at the current string position is ASCII, otherwise returns an empty Optional.
+    ALWAYS_INLINE Optional<ExecutionResult> execute(MatchInput const& input, MatchState& state) const
+    {
+        if (!m_current || !m_current->is_compiled)
+            return {};
+
+        auto const& table_indices = m_current->table_indices;
+        if (state.instruction_position >= table_indices.size())
+            return {};
+
+        auto table_index = table_indices.data()[state.instruction_position];
+        if (table_index < 0)
+            return {};
+
+        if (state.string_position >= input.view.length() || state.string_position_in_code_units >= input.view.length_in_code_units())
+            return {};
+
+        auto code_point = input.view.unicode_aware_code_point_at(state.string_position_in_code_units);
+        if (code_point >= 128)
+            return {};
+
+        state.string_position_before_match = state.string_position;
+
+        auto const& table = m_current->tables.data()[table_index];
+        if (!((table[code_point / 64] >> (code_point % 64)) & 1))
+            return ExecutionResult::Failed_ExecuteLowPrioForks;
+
+        ++state.string_position;
+        ++state.string_position_in_code_units;
+        return ExecutionResult::Continue;
+    }
+
+    bool is_compiled() const { return m_current && m_current->is_compiled; }
+
+private:
+    static constexpr size_t max_option_sets = 4;
+
+    struct CompiledForOptions {
+        AllOptions options;
+        bool unicode { false };
+        size_t execution_count { 0 };
+        bool is_compiled { false };
+        Vector<i32> table_indices;
+        Vector<Array<u64, 2>> tables;
+    };
+
+    static bool is_compilable(OpCode_Compare const&);
+    static void compile(ByteCode const&, MatchInput const&, CompiledForOptions&);
+
+    Vector<CompiledForOptions, max_option_sets> m_compiled_for_options;
+    CompiledForOptions const* m_current { nullptr };
+};
+
+}
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashFunctions.h>
+#include <AK/QuickSort.h>
+#include <LibRegex/RegexLazyDFA.h>
+
+namespace regex {
+
+bool LazyDFA::is_eligible(ByteCode const& bytecode)
+{
+    auto state = MatchState::only_for_enumeration();
+    auto bytecode_size = bytecode.size();
+    while (state.instruction_position < bytecode_size) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare:
+            for (auto const& compare : static_cast<OpCode_Compare const&>(opcode).flat_compares()) {
+                switch (compare.type) {
+                case CharacterCompareType::Undefined:
+                case CharacterCompareType::String:
+                case CharacterCompareType::Reference:
+                case CharacterCompareType::NamedReference:
+                case CharacterCompareType::RangeExpressionDummy:
+                    // These either consume a variable number of characters or depend on earlier captures.
+                    return false;
+                default:
+                    break;
+                }
+            }
+            break;
+        case OpCodeId::Jump:
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceJump:
+        case OpCodeId::ForkReplaceStay:
+        case OpCodeId::JumpNonEmpty:
+        case OpCodeId::Checkpoint:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckEnd:
+        case OpCodeId::CheckBoundary:
+        case OpCodeId::Exit:
+            break;
+        default:
+            // Lookaround (Save/Restore/GoBack/PopSaved/FailForks) and counted repetition need the VM.
+            return false;
+        }
+        state.instruction_position += opcode.size();
+    }
+    return true;
+}
+
+void LazyDFA::reset(AllOptions options)
+{
+    m_states.clear();
+    m_states_by_hash.clear();
+    m_anchored_start.clear();
+    m_unanchored_start.clear();
+    m_options = options;
+}
+
+void LazyDFA::add_closure(ByteCode const& bytecode, size_t instruction_position, Vector<size_t>& compares, bool& accepting)
+{
+    Vector<size_t, 16> worklist;
+    worklist.append(instruction_position);
+
+    while (!worklist.is_empty()) {
+        auto position = worklist.take_last();
+        if (m_visited.set(position) != HashSetResult::InsertedNewEntry)
+            continue;
+
+        m_scratch_state.instruction_position = position;
+        auto& opcode = bytecode.get_opcode(m_scratch_state);
+        auto next_position = position + opcode.size();
+
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare:
+            compares.append(position);
+            break;
+        case OpCodeId::Exit:
+            accepting = true;
+            break;
+        case OpCodeId::Jump:
+            worklist.append(next_position + static_cast<OpCode_Jump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkReplaceJump:
+            worklist.append(next_position);
+            worklist.append(next_position + static_cast<OpCode_ForkJump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceStay:
+            worklist.append(next_position);
+            worklist.append(next_position + static_cast<OpCode_ForkStay const&>(opcode).offset());
+            break;
+        case OpCodeId::JumpNonEmpty:
+            // Whether the loop body was empty doesn't change which strings the loop accepts.
+            worklist.append(next_position);
+            worklist.append(next_position + static_cast<OpCode_JumpNonEmpty const&>(opcode).offset());
+            break;
+        default:
+            // Captures, checkpoints and assertions are assumed to always succeed.
+            worklist.append(next_position);
+            break;
+        }
+    }
+}
+
+Optional<u32> LazyDFA::intern_state(Vector<size_t>&& compares, bool accepting, bool unanchored)
+{
+    quick_sort(compares);
+
+    u32 hash = (accepting ? 1 : 0) | (unanchored ? 2 : 0);
+    for (auto position : compares)
+        hash = pair_int_hash(hash, static_cast<u32>(position));
+
+    auto& candidates = m_states_by_hash.ensure(hash);
+    for (auto index : candidates) {
+        auto const& state = m_states[index];
+        if (state.accepting == accepting && state.unanchored == unanchored && state.compares == compares)
+            return index;
+    }
+
+    if (m_states.size() >= max_state_count)
+        return {};
+
+    State state;
+    state.compares = move(compares);
+    state.accepting = accepting;
+    state.unanchored = unanchored;
+    state.ascii_transitions.fill(unknown_transition);
+
+    u32 index = m_states.size();
+    m_states.append(move(state));
+    candidates.append(index);
+    return index;
+}
+
+Optional<u32> LazyDFA::start_state(ByteCode const& bytecode, Mode mode)
+{
+    auto& start = mode == Mode::Anchored ? m_anchored_start : m_unanchored_start;
+    if (start.has_value())
+        return start;
+
+    Vector<size_t> compares;
+    bool accepting = false;
+    m_visited.clear_with_capacity();
+    add_closure(bytecode, 0, compares, accepting);
+    start = intern_state(move(compares), accepting, mode == Mode::Unanchored);
+    return start;
+}
+
+Optional<u32> LazyDFA::transition(ByteCode const& bytecode, MatchInput const& input, u32 state_index, size_t position)
+{
+    auto code_point = input.view.unicode_aware_code_point_at(position);
+    if (code_point < ascii_transition_count) {
+        if (auto cached = m_states[state_index].ascii_transitions[code_point]; cached != unknown_transition)
+            return static_cast<u32>(cached);
+    } else if (auto cached = m_states[state_index].transitions.get(code_point); cached.has_value()) {
+        return cached;
+    }
+
+    Vector<size_t> next_compares;
+    bool accepting = false;
+    auto unanchored = m_states[state_index].unanchored;
+    m_visited.clear_with_capacity();
+
+    // The result of a single-character compare only depends on the character and the options,
+    // so evaluating it at this position gives us the transition for every occurrence of the character.
+    for (auto compare_position : m_states[state_index].compares) {
+        m_scratch_state.instruction_position = compare_position;
+        m_scratch_state.string_position = position;
+        m_scratch_state.string_position_in_code_units = position;
+
+        auto& opcode = bytecode.get_opcode(m_scratch_state);
+        auto next_position = compare_position + opcode.size();
+        auto result = opcode.execute(input, m_scratch_state);
+        if (result == ExecutionResult::Continue && m_scratch_state.string_position == position + 1)
+            add_closure(bytecode, next_position, next_compares, accepting);
+    }
+
+    if (unanchored)
+        add_closure(bytecode, 0, next_compares, accepting);
+
+    auto next_state = intern_state(move(next_compares), accepting, unanchored);
+    if (!next_state.has_value())
+        return {};
+
+    if (code_point < ascii_transition_count)
+        m_states[state_index].ascii_transitions[code_point] = static_cast<i32>(*next_state);
+    else
+        m_states[state_index].transitions.set(code_point, *next_state);
+    return next_state;
+}
+
+LazyDFA::Result LazyDFA::find_possible_match(ByteCode const& bytecode, MatchInput const& input, size_t start_position, Mode mode)
+{
+    if (m_gave_up || input.view.unicode())
+        return Result::GaveUp;
+
+    if (m_options.value() != input.regex_options.value())
+        reset(input.regex_options);
+
+    auto state_index = start_state(bytecode, mode);
+    auto length = input.view.length();
+
+    for (auto position = start_position;; ++position) {
+        if (!state_index.has_value()) {
+            // Too many distinct states, this pattern is better served by the VM alone.
+            m_gave_up = true;
+            reset(m_options);
+            return Result::GaveUp;
+        }
+
+        auto const& state = m_states[*state_index];
+        if (state.accepting)
+            return Result::MayMatch;
+        if (state.is_dead() || position >= length)
+            return Result::NoMatch;
+
+        state_index = transition(bytecode, input, *state_index, position);
+    }
+}
+
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include "RegexByteCode.h"
+#include "RegexMatch.h"
+#include "RegexOptions.h"
+
+#include <AK/Array.h>
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/Optional.h>
+#include <AK/Types.h>
+#include <AK/Vector.h>
+
+namespace regex {
+
+// A DFA whose states are built on demand from the bytecode while scanning the input.
+//
+// Each DFA state is the set of Compare instructions the VM could be sitting on at the current
+// string position, computed by following every jump and fork in the bytecode. Capture groups,
+// checkpoints and assertions are treated as no-ops, so the automaton accepts a superset of what
+// the backtracking VM would accept; it can therefore only ever say "this definitely can't match"
+// or "this might match", and the VM remains responsible for producing the actual match and its
+// captures. Patterns that need state the DFA can't model (backreferences, lookaround, counted
+// repetitions) are rejected by is_eligible().
+class REGEX_API LazyDFA {
+public:
+    enum class Mode : u8 {
+        // Only consider matches that start at the given position.
+        Anchored,
+        // Consider matches starting at any position at or after the given position.
+        Unanchored,
+    };
+
+    enum class Result : u8 {
+        NoMatch,
+        MayMatch,
+        GaveUp,
+    };
+
+    static bool is_eligible(ByteCode const&);
+
+    // Only inputs indexed by code unit are supported; returns GaveUp for anything else.
+    Result find_possible_match(ByteCode const&, MatchInput const&, size_t start_position, Mode);
+
+private:
+    static constexpr size_t max_state_count = 2048;
+    static constexpr i32 unknown_transition = -1;
+    static constexpr size_t ascii_transition_count = 128;
+
+    struct State {
+        Vector<size_t> compares;
+        bool accepting { false };
+        bool unanchored { false };
+        Array<i32, ascii_transition_count> ascii_transitions;
+        HashMap<u32, u32> transitions;
+
+        bool is_dead() const { return compares.is_empty() && !accepting; }
+    };
+
+    void reset(AllOptions);
+    void add_closure(ByteCode const&, size_t instruction_position, Vector<size_t>& compares, bool& accepting);
+    Optional<u32> intern_state(Vector<size_t>&& compares, bool accepting, bool unanchored);
+    Optional<u32> start_state(ByteCode const&, Mode);
+    Optional<u32> transition(ByteCode const&, MatchInput const&, u32 state_index, size_t position);
+
+    Vector<State> m_states;
+    HashMap<u32, Vector<u32>> m_states_by_hash;
+    Optional<u32> m_anchored_start;
+    Optional<u32> m_unanchored_start;
+    HashTable<size_t> m_visited;
+    MatchState m_scratch_state { MatchState::only_for_enumeration() };
+    AllOptions m_options {};
+    bool m_gave_up { false };
+};
+
+}
@@ -233,6 +233,22 @@ public:
             [&](Utf16View const& view) -> u32 { return view.code_unit_at(code_unit_index); });
     }
 
+    // Returns the offset of the first code unit equal to the given one at or after the start offset.
+    Optional<size_t> find_code_unit_offset(u32 code_unit, size_t start_offset) const
+    {
+        return m_view.visit(
+            [&](StringView view) -> Optional<size_t> {
+                if (code_unit > 0xff)
+                    return {};
+                return view.find(static_cast<char>(code_unit), start_offset);
+            },
+            [&](Utf16View const& view) -> Optional<size_t> {
+                if (code_unit > 0xffff)
+                    return {};
+                return view.find_code_unit_offset(static_cast<char16_t>(code_unit), start_offset);
+            });
+    }
+
     size_t code_unit_offset_of(size_t code_point_index) const
     {
         return m_view.visit(
@@ -157,6 +157,92 @@ RegexResult Matcher<Parser>::match(RegexStringView view, Optional<typename Parse
     return match(views, regex_options);
 }
 
+// Once this many forks have been taken without finding a match, start memoizing failed forks.
+static constexpr size_t c_memoization_fork_threshold = 4096;
+static constexpr size_t c_max_memoized_forks = 1 * MiB;
+
+// Remembers the forks the VM has already explored, keyed on the fork, the string position and the live checkpoints
+// (see find_memoizable_forks()). Anything explored before is either still being explored further up the stack or
+// has failed, so it never needs to be explored again; this bounds the work done for a view by the number of keys.
+struct BacktrackingMemo {
+    HashMap<size_t, MemoizableFork> const& memoizable_forks;
+    size_t fork_count { 0 };
+    bool enabled { false };
+    HashTable<u64> visited_forks;
+
+    void note_fork()
+    {
+        if (enabled || memoizable_forks.is_empty())
+            return;
+        if (++fork_count > c_memoization_fork_threshold)
+            enabled = true;
+    }
+
+    bool has_visited(OpCode const& opcode, MatchState const& state)
+    {
+        switch (opcode.opcode_id()) {
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkStay:
+            break;
+        case OpCodeId::JumpNonEmpty: {
+            // Only a JumpNonEmpty that is about to fork is interesting, see OpCode_JumpNonEmpty::execute().
+            auto const& jump = static_cast<OpCode_JumpNonEmpty const&>(opcode);
+            auto checkpoint_position = state.checkpoints.get(jump.checkpoint()).value_or(0);
+            if (checkpoint_position == 0 || checkpoint_position == state.string_position + 1)
+                return false;
+            break;
+        }
+        default:
+            return false;
+        }
+
+        auto fork = memoizable_forks.find(state.instruction_position);
+        if (fork == memoizable_forks.end())
+            return false;
+
+        // Without live checkpoints the key is exact; otherwise, much like MatchState::u64_hash(), we accept
+        // the (tiny) chance of a collision.
+        u64 key = static_cast<u64>(state.string_position) * memoizable_forks.size() + fork->value.index;
+        for (auto checkpoint : fork->value.live_checkpoints) {
+            key ^= state.checkpoints.get(checkpoint).value_or(0) + 0x9e3779b97f4a7c15 + (key << 6) + (key >> 2);
+            key *= 0x100000001b3;
+        }
+
+        if (visited_forks.size() >= c_max_memoized_forks)
+            return visited_forks.contains(key);
+        return visited_forks.set(key) != HashSetResult::InsertedNewEntry;
+    }
+
+    // Must be called whenever a match is found, as the forks that were still being explored have not necessarily failed.
+    void reset()
+    {
+        fork_count = 0;
+        enabled = false;
+        visited_forks.clear();
+    }
+};
+
+// Finds the next offset at or after the start offset at which the given literal occurs.
+// Only valid for views that are indexed by code unit.
+static Optional<size_t> find_literal_prefix(RegexStringView const& view, ReadonlySpan<u32> prefix, size_t start_offset)
+{
+    auto length = view.length();
+    while (start_offset + prefix.size() <= length) {
+        auto candidate = view.find_code_unit_offset(prefix.first(), start_offset);
+        if (!candidate.has_value() || candidate.value() + prefix.size() > length)
+            return {};
+
+        size_t matched = 1;
+        while (matched < prefix.size() && view.unicode_aware_code_point_at(candidate.value() + matched) == prefix[matched])
+            ++matched;
+        if (matched == prefix.size())
+            return candidate;
+
+        start_offset = candidate.value() + 1;
+    }
+    return {};
+}
+
 template<typename Parser>
 RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optional<typename ParserTraits<Parser>::OptionsType> regex_options) const
 {
@@ -168,6 +254,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
     MatchInput input;
     MatchState state { m_pattern->parser_result.capture_groups_count };
+    BacktrackingMemo memo { m_pattern->parser_result.optimization_data.memoizable_forks };
     size_t operations = 0;
 
     input.regex_options = m_regex_options | regex_options.value_or({}).value();
@@ -235,6 +322,8 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             continue;
         }
         input.view = view;
+        memo.reset();
+        m_compiled_compares.prepare(m_pattern->parser_result.bytecode, input);
         dbgln_if(REGEX_DEBUG, "[match] Starting match with view ({}): _{}_", view.length(), view);
 
         auto view_length = view.length();
@@ -262,7 +351,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.instruction_position = 0;
             state.repetition_marks.clear();
 
-            auto success = execute(input, state, temp_operations);
+            auto success = execute(input, state, temp_operations, memo);
             // This success is acceptable only if it doesn't read anything from the input (input length is 0).
             if (success && (state.string_position <= view_index)) {
                 operations = temp_operations;
@@ -279,12 +368,31 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             }
         }
 
+        // The lazy DFA accepts a superset of what the VM does, so if it can't find anything in this view, neither will the VM.
+        if (!can_possibly_match_from(input, view_index, LazyDFA::Mode::Unanchored))
+            view_index = view_length + 1;
+
+        // When we're free to pick the start position, skip straight to the places where the literal prefix occurs.
+        auto const& literal_prefix = m_pattern->parser_result.optimization_data.literal_prefix;
+        bool const can_skip_to_literal_prefix = !literal_prefix.is_empty()
+            && continue_search
+            && !only_start_of_line
+            && !view.unicode()
+            && !input.regex_options.has_flag_set(AllFlags::Insensitive);
+
         for (; view_index <= view_length; ++view_index) {
             if (view_index == view_length) {
                 if (input.regex_options.has_flag_set(AllFlags::Multiline))
                     break;
             }
 
+            if (can_skip_to_literal_prefix) {
+                auto next_candidate = find_literal_prefix(view, literal_prefix, view_index);
+                if (!next_candidate.has_value())
+                    break;
+                view_index = next_candidate.value();
+            }
+
             // FIXME: More performant would be to know the remaining minimum string
             //        length needed to match from the current position onwards within
             //        the vm. Add new OpCode for MinMatchLengthFromSp with the value of
@@ -306,6 +414,9 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
                     goto done_matching;
             }
 
+            if (!can_possibly_match_from(input, view_index, LazyDFA::Mode::Anchored))
+                goto done_matching;
+
             input.column = match_count;
             input.match_index = match_count;
 
@@ -321,7 +432,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.instruction_position = 0;
             state.repetition_marks.clear();
 
-            if (execute(input, state, operations)) {
+            if (execute(input, state, operations, memo)) {
                 succeeded = true;
 
                 if (input.regex_options.has_flag_set(AllFlags::MatchNotEndOfLine) && state.string_position == input.view.length()) {
@@ -408,6 +519,18 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
     return result;
 }
 
+template<typename Parser>
+bool Matcher<Parser>::can_possibly_match_from(MatchInput const& input, size_t position, LazyDFA::Mode mode) const
+{
+    if (!m_pattern->parser_result.optimization_data.can_use_lazy_dfa || input.view.unicode())
+        return true;
+
+    if (!m_lazy_dfa)
+        m_lazy_dfa = make<LazyDFA>();
+
+    return m_lazy_dfa->find_possible_match(m_pattern->parser_result.bytecode, input, position, mode) != LazyDFA::Result::NoMatch;
+}
+
 template<typename T>
 class BumpAllocatedLinkedList {
 public:
@@ -497,7 +620,7 @@ struct SufficientlyUniformValueTraits : DefaultTraits<u64> {
 };
 
 template<class Parser>
-bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t& operations) const
+bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t& operations, BacktrackingMemo& memo) const
 {
     BumpAllocatedLinkedList<MatchState> states_to_try_next;
     HashTable<u64, SufficientlyUniformValueTraits> seen_state_hashes;
@@ -519,6 +642,11 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
         if (input.fail_counter > 0) {
             --input.fail_counter;
             result = ExecutionResult::Failed_ExecuteLowPrioForks;
+        } else if (memo.enabled && memo.has_visited(opcode, state)) {
+            dbgln_if(REGEX_DEBUG, "Already explored this fork at this position, skipping");
+            result = ExecutionResult::Failed_ExecuteLowPrioForks;
+        } else if (auto compiled_result = m_compiled_compares.execute(input, state); compiled_result.has_value()) {
+            result = compiled_result.release_value();
         } else {
             result = opcode.execute(input, state);
         }
@@ -531,6 +659,7 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
 
         switch (result) {
         case ExecutionResult::Fork_PrioLow: {
+            memo.note_fork();
             bool found = false;
             if (input.fork_to_replace.has_value()) {
                 for (auto it = states_to_try_next.reverse_begin(); it != states_to_try_next.reverse_end(); ++it) {
@@ -552,6 +681,7 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
             continue;
         }
         case ExecutionResult::Fork_PrioHigh: {
+            memo.note_fork();
             bool found = false;
             if (input.fork_to_replace.has_value()) {
                 for (auto it = states_to_try_next.reverse_begin(); it != states_to_try_next.reverse_end(); ++it) {
@@ -577,6 +707,7 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
         case ExecutionResult::Continue:
             continue;
         case ExecutionResult::Succeeded:
+            memo.reset();
             return true;
         case ExecutionResult::Failed: {
             bool found = false;
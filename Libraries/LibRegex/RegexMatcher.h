@@ -7,6 +7,8 @@
 #pragma once
 
 #include "RegexByteCode.h"
+#include "RegexCompiledCompares.h"
+#include "RegexLazyDFA.h"
 #include "RegexMatch.h"
 #include "RegexOptions.h"
 #include "RegexParser.h"
@@ -32,6 +34,8 @@ struct Block {
 
 static constexpr size_t const c_max_recursion = 5000;
 
+struct BacktrackingMemo;
+
 struct REGEX_API RegexResult final {
     bool success { false };
     size_t count { 0 };
@@ -70,11 +74,16 @@ public:
         m_pattern = pattern;
     }
 
+    CompiledCompares const& compiled_compares() const { return m_compiled_compares; }
+
 private:
-    bool execute(MatchInput const& input, MatchState& state, size_t& operations) const;
+    bool execute(MatchInput const& input, MatchState& state, size_t& operations, BacktrackingMemo& memo) const;
+    bool can_possibly_match_from(MatchInput const& input, size_t position, LazyDFA::Mode) const;
 
     Regex<Parser> const* m_pattern;
     typename ParserTraits<Parser>::OptionsType const m_regex_options;
+    mutable OwnPtr<LazyDFA> m_lazy_dfa;
+    mutable CompiledCompares m_compiled_compares;
 };
 
 template<class Parser>
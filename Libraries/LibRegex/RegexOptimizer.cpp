@@ -25,6 +25,159 @@ namespace regex {
 
 using Detail::Block;
 
+// Finds the forks whose outcome only depends on the string position they're executed at and the values of the few
+// checkpoints that can still be observed after them. If the VM fails to find a match from such a fork once, it will
+// fail every time it gets back to it in the same situation, so the matcher can memoize these failures.
+static HashMap<size_t, MemoizableFork> find_memoizable_forks(ByteCode const& bytecode)
+{
+    static constexpr size_t max_liveness_words = 1 * MiB;
+    static constexpr size_t max_live_checkpoints_per_fork = 4;
+
+    struct Instruction {
+        size_t position { 0 };
+        Vector<size_t, 2> successors;
+        Optional<size_t> defined_checkpoint;
+        Optional<size_t> used_checkpoint;
+        bool is_fork { false };
+    };
+
+    Vector<Instruction> instructions;
+    HashMap<size_t, size_t> instruction_indices;
+    HashMap<size_t, size_t> checkpoint_indices;
+    Vector<size_t> checkpoint_ids;
+
+    auto checkpoint_index = [&](size_t id) {
+        if (auto index = checkpoint_indices.get(id); index.has_value())
+            return index.value();
+        auto index = checkpoint_ids.size();
+        checkpoint_indices.set(id, index);
+        checkpoint_ids.append(id);
+        return index;
+    };
+
+    auto state = MatchState::only_for_enumeration();
+    auto bytecode_size = bytecode.size();
+    while (state.instruction_position < bytecode_size) {
+        auto& opcode = bytecode.get_opcode(state);
+        auto next_position = state.instruction_position + opcode.size();
+
+        Instruction instruction { .position = state.instruction_position };
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare:
+            for (auto const& compare : static_cast<OpCode_Compare const&>(opcode).flat_compares()) {
+                // Backreferences make the outcome depend on previously captured text.
+                if (compare.type == CharacterCompareType::Reference || compare.type == CharacterCompareType::NamedReference)
+                    return {};
+            }
+            instruction.successors.append(next_position);
+            break;
+        case OpCodeId::Jump:
+            instruction.successors.append(next_position + static_cast<OpCode_Jump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkJump:
+            instruction.successors.append(next_position);
+            instruction.successors.append(next_position + static_cast<OpCode_ForkJump const&>(opcode).offset());
+            instruction.is_fork = true;
+            break;
+        case OpCodeId::ForkStay:
+            instruction.successors.append(next_position);
+            instruction.successors.append(next_position + static_cast<OpCode_ForkStay const&>(opcode).offset());
+            instruction.is_fork = true;
+            break;
+        case OpCodeId::JumpNonEmpty: {
+            auto const& jump = static_cast<OpCode_JumpNonEmpty const&>(opcode);
+            if (jump.form() != OpCodeId::Jump && jump.form() != OpCodeId::ForkJump && jump.form() != OpCodeId::ForkStay)
+                return {};
+            instruction.successors.append(next_position);
+            instruction.successors.append(next_position + jump.offset());
+            instruction.used_checkpoint = checkpoint_index(jump.checkpoint());
+            instruction.is_fork = jump.form() != OpCodeId::Jump;
+            break;
+        }
+        case OpCodeId::Checkpoint:
+            instruction.successors.append(next_position);
+            instruction.defined_checkpoint = checkpoint_index(static_cast<OpCode_Checkpoint const&>(opcode).id());
+            break;
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckEnd:
+        case OpCodeId::CheckBoundary:
+            instruction.successors.append(next_position);
+            break;
+        case OpCodeId::Exit:
+            break;
+        default:
+            // Lookaround, atomic groups and counted repetition all carry state that isn't part of the key.
+            return {};
+        }
+
+        instruction_indices.set(instruction.position, instructions.size());
+        instructions.append(move(instruction));
+        state.instruction_position = next_position;
+    }
+
+    // Backwards liveness analysis of the checkpoints, one bit per checkpoint per instruction.
+    auto words_per_instruction = ceil_div(checkpoint_ids.size(), static_cast<size_t>(64));
+    if (instructions.size() * words_per_instruction > max_liveness_words)
+        return {};
+
+    Vector<u64> live_in;
+    live_in.resize(instructions.size() * words_per_instruction);
+
+    auto live_out = [&](Instruction const& instruction, size_t word) {
+        u64 live = 0;
+        for (auto successor : instruction.successors) {
+            if (auto index = instruction_indices.get(successor); index.has_value())
+                live |= live_in[index.value() * words_per_instruction + word];
+        }
+        return live;
+    };
+
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (size_t i = instructions.size(); i-- > 0;) {
+            auto const& instruction = instructions[i];
+            for (size_t word = 0; word < words_per_instruction; ++word) {
+                auto live = live_out(instruction, word);
+                if (instruction.defined_checkpoint.has_value() && instruction.defined_checkpoint.value() / 64 == word)
+                    live &= ~(1ull << (instruction.defined_checkpoint.value() % 64));
+                if (instruction.used_checkpoint.has_value() && instruction.used_checkpoint.value() / 64 == word)
+                    live |= 1ull << (instruction.used_checkpoint.value() % 64);
+
+                auto& slot = live_in[i * words_per_instruction + word];
+                if (slot != live) {
+                    slot = live;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    // A fork's own use of a checkpoint (in JumpNonEmpty) is already decided by the time it forks,
+    // so only the checkpoints live after it need to be part of its key.
+    HashMap<size_t, MemoizableFork> memoizable_forks;
+    for (auto const& instruction : instructions) {
+        if (!instruction.is_fork)
+            continue;
+
+        MemoizableFork fork { .index = memoizable_forks.size() };
+        for (size_t word = 0; word < words_per_instruction; ++word) {
+            auto live = live_out(instruction, word);
+            for (size_t bit = 0; live != 0; ++bit, live >>= 1) {
+                if (live & 1)
+                    fork.live_checkpoints.append(checkpoint_ids[word * 64 + bit]);
+            }
+        }
+
+        if (fork.live_checkpoints.size() <= max_live_checkpoints_per_fork)
+            memoizable_forks.set(instruction.position, move(fork));
+    }
+    return memoizable_forks;
+}
+
 template<typename Parser>
 void Regex<Parser>::run_optimization_passes()
 {
@@ -40,6 +193,9 @@ void Regex<Parser>::run_optimization_passes()
 
     fill_optimization_data(split_basic_blocks(parser_result.bytecode));
 
+    parser_result.optimization_data.can_use_lazy_dfa = LazyDFA::is_eligible(parser_result.bytecode);
+    parser_result.optimization_data.memoizable_forks = find_memoizable_forks(parser_result.bytecode);
+
     parser_result.bytecode.flatten();
 }
 
@@ -179,12 +335,53 @@ static bool interpret_compares(Vector<CompareTypeAndValuePair> const& lhs, Stati
     return true;
 }
 
+// Collects the characters every match has to start with, i.e. the single-character compares reachable from
+// the start of the bytecode without passing through any jumps or forks.
+static Vector<u32> extract_literal_prefix(ByteCode const& bytecode)
+{
+    Vector<u32> prefix;
+
+    auto state = MatchState::only_for_enumeration();
+    auto bytecode_size = bytecode.size();
+    while (state.instruction_position < bytecode_size) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare: {
+            StaticallyInterpretedCompares compares;
+            if (!interpret_compares(static_cast<OpCode_Compare const&>(opcode).flat_compares(), compares))
+                return prefix;
+
+            if (compares.has_any_unicode_property || !compares.char_classes.is_empty() || !compares.negated_char_classes.is_empty() || !compares.negated_ranges.is_empty())
+                return prefix;
+            if (compares.ranges.size() != 1 || compares.ranges.begin().key() != *compares.ranges.begin())
+                return prefix;
+
+            prefix.append(*compares.ranges.begin());
+            break;
+        }
+        case OpCodeId::Checkpoint:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+            break;
+        default:
+            return prefix;
+        }
+        state.instruction_position += opcode.size();
+    }
+
+    return prefix;
+}
+
 template<class Parser>
 void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
 {
     if (blocks.is_empty())
         return;
 
+    parser_result.optimization_data.literal_prefix = extract_literal_prefix(parser_result.bytecode);
+
     if constexpr (REGEX_DEBUG) {
         dbgln("Pulling out optimization data from bytecode:");
         RegexDebug dbg;
@@ -201,6 +398,7 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
             for (auto const& range : parser_result.optimization_data.starting_ranges)
                 dbgln("  - starting range: {}-{}", range.from, range.to);
             dbgln("; - only start of line: {}", parser_result.optimization_data.only_start_of_line);
+            dbgln("; - literal prefix length: {}", parser_result.optimization_data.literal_prefix.size());
         }
     };
 
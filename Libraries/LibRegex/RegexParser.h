@@ -50,6 +50,12 @@ struct NamedCaptureGroup {
     size_t alternative_id;
 };
 
+struct MemoizableFork {
+    size_t index { 0 };
+    // The checkpoints that can still be observed after the fork, whose values are part of the memoization key.
+    Vector<size_t, 2> live_checkpoints;
+};
+
 class REGEX_API Parser {
 public:
     struct Result {
@@ -68,6 +74,12 @@ public:
             Vector<CharRange> starting_ranges;
             Vector<CharRange> starting_ranges_insensitive;
             bool only_start_of_line = false;
+            // If populated, every match starts with exactly these characters.
+            Vector<u32> literal_prefix;
+            // If set, the pattern can be pre-screened with a LazyDFA before running the VM.
+            bool can_use_lazy_dfa = false;
+            // The forks whose failures can be memoized, by instruction position; see find_memoizable_forks().
+            HashMap<size_t, MemoizableFork> memoizable_forks;
         } optimization_data {};
     };
 
@@ -11,8 +11,10 @@
 #include <AK/HashMap.h>
 #include <AK/HashTable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
 #include <AK/StackInfo.h>
 #include <AK/UFixedBigInt.h>
+#include <LibThreading/Mutex.h>
 #include <LibWasm/Export.h>
 #include <LibWasm/Types.h>
 
@@ -451,6 +453,14 @@ private:
     TableType m_type;
 };
 
+struct AtomicWaiter;
+
+// The threads parked in memory.atomic.wait on the locations of a shared memory, in the order they started waiting.
+struct AtomicWaiterList {
+    Threading::Mutex mutex;
+    Vector<AtomicWaiter*> waiters;
+};
+
 class MemoryInstance {
 public:
     static ErrorOr<MemoryInstance> create(MemoryType const& type)
@@ -507,7 +517,7 @@ public:
             //
             // See relevant spec link:
             // https://www.w3.org/TR/wasm-core-2/#growing-memories%E2%91%A0
-            m_type = MemoryType { Limits(m_type.limits().address_type(), m_type.limits().min() + size_to_grow / Constants::page_size, m_type.limits().max()) };
+            m_type = MemoryType { Limits(m_type.limits().address_type(), m_type.limits().min() + size_to_grow / Constants::page_size, m_type.limits().max(), m_type.limits().shared()) };
         }
 
         return true;
@@ -515,15 +525,21 @@ public:
 
     Function<void()> successful_grow_hook;
 
+    // Only shared memories can be waited on.
+    AtomicWaiterList* atomic_waiters() { return m_atomic_waiters.ptr(); }
+
 private:
     explicit MemoryInstance(MemoryType const& type)
         : m_type(type)
     {
+        if (m_type.limits().is_shared())
+            m_atomic_waiters = make<AtomicWaiterList>();
     }
 
     MemoryType m_type;
     size_t m_size { 0 };
     ByteBuffer m_data;
+    OwnPtr<AtomicWaiterList> m_atomic_waiters;
 };
 
 class GlobalInstance {
@@ -15,6 +15,8 @@
 #include <AK/RedBlackTree.h>
 #include <AK/SIMDExtras.h>
 #include <AK/Time.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
@@ -3784,6 +3786,474 @@ HANDLE_INSTRUCTION(try_table)
     return Outcome::Return;
 }
 
+HANDLE_INSTRUCTION(memory_atomic_notify)
+{
+    if (interpreter.atomic_notify(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(memory_atomic_wait32)
+{
+    if (interpreter.atomic_wait<i32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(memory_atomic_wait64)
+{
+    if (interpreter.atomic_wait<i64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(atomic_fence)
+{
+    AK::atomic_thread_fence(AK::memory_order_seq_cst);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_load)
+{
+    if (interpreter.atomic_load_and_push<u32, i32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_load)
+{
+    if (interpreter.atomic_load_and_push<u64, i64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_load8_u)
+{
+    if (interpreter.atomic_load_and_push<u8, i32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_load16_u)
+{
+    if (interpreter.atomic_load_and_push<u16, i32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_load8_u)
+{
+    if (interpreter.atomic_load_and_push<u8, i64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_load16_u)
+{
+    if (interpreter.atomic_load_and_push<u16, i64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_load32_u)
+{
+    if (interpreter.atomic_load_and_push<u32, i64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_store)
+{
+    if (interpreter.atomic_pop_and_store<i32, u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_store)
+{
+    if (interpreter.atomic_pop_and_store<i64, u64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_store8)
+{
+    if (interpreter.atomic_pop_and_store<i32, u8>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_store16)
+{
+    if (interpreter.atomic_pop_and_store<i32, u16>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_store8)
+{
+    if (interpreter.atomic_pop_and_store<i64, u8>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_store16)
+{
+    if (interpreter.atomic_pop_and_store<i64, u16>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_store32)
+{
+    if (interpreter.atomic_pop_and_store<i64, u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_add)
+{
+    if (interpreter.atomic_read_modify_write<i32, u32, Operators::AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_add)
+{
+    if (interpreter.atomic_read_modify_write<i64, u64, Operators::AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_add_u)
+{
+    if (interpreter.atomic_read_modify_write<i32, u8, Operators::AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_add_u)
+{
+    if (interpreter.atomic_read_modify_write<i32, u16, Operators::AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_add_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u8, Operators::AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_add_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u16, Operators::AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_add_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u32, Operators::AtomicAdd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_sub)
+{
+    if (interpreter.atomic_read_modify_write<i32, u32, Operators::AtomicSubtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_sub)
+{
+    if (interpreter.atomic_read_modify_write<i64, u64, Operators::AtomicSubtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_sub_u)
+{
+    if (interpreter.atomic_read_modify_write<i32, u8, Operators::AtomicSubtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_sub_u)
+{
+    if (interpreter.atomic_read_modify_write<i32, u16, Operators::AtomicSubtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_sub_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u8, Operators::AtomicSubtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_sub_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u16, Operators::AtomicSubtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_sub_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u32, Operators::AtomicSubtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_and)
+{
+    if (interpreter.atomic_read_modify_write<i32, u32, Operators::AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_and)
+{
+    if (interpreter.atomic_read_modify_write<i64, u64, Operators::AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_and_u)
+{
+    if (interpreter.atomic_read_modify_write<i32, u8, Operators::AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_and_u)
+{
+    if (interpreter.atomic_read_modify_write<i32, u16, Operators::AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_and_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u8, Operators::AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_and_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u16, Operators::AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_and_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u32, Operators::AtomicAnd>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_or)
+{
+    if (interpreter.atomic_read_modify_write<i32, u32, Operators::AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_or)
+{
+    if (interpreter.atomic_read_modify_write<i64, u64, Operators::AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_or_u)
+{
+    if (interpreter.atomic_read_modify_write<i32, u8, Operators::AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_or_u)
+{
+    if (interpreter.atomic_read_modify_write<i32, u16, Operators::AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_or_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u8, Operators::AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_or_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u16, Operators::AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_or_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u32, Operators::AtomicOr>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_xor)
+{
+    if (interpreter.atomic_read_modify_write<i32, u32, Operators::AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_xor)
+{
+    if (interpreter.atomic_read_modify_write<i64, u64, Operators::AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_xor_u)
+{
+    if (interpreter.atomic_read_modify_write<i32, u8, Operators::AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_xor_u)
+{
+    if (interpreter.atomic_read_modify_write<i32, u16, Operators::AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_xor_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u8, Operators::AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_xor_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u16, Operators::AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_xor_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u32, Operators::AtomicXor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_xchg)
+{
+    if (interpreter.atomic_read_modify_write<i32, u32, Operators::AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_xchg)
+{
+    if (interpreter.atomic_read_modify_write<i64, u64, Operators::AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_xchg_u)
+{
+    if (interpreter.atomic_read_modify_write<i32, u8, Operators::AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_xchg_u)
+{
+    if (interpreter.atomic_read_modify_write<i32, u16, Operators::AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_xchg_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u8, Operators::AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_xchg_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u16, Operators::AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_xchg_u)
+{
+    if (interpreter.atomic_read_modify_write<i64, u32, Operators::AtomicExchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_cmpxchg)
+{
+    if (interpreter.atomic_compare_exchange<i32, u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_cmpxchg)
+{
+    if (interpreter.atomic_compare_exchange<i64, u64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_cmpxchg_u)
+{
+    if (interpreter.atomic_compare_exchange<i32, u8>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_cmpxchg_u)
+{
+    if (interpreter.atomic_compare_exchange<i32, u16>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_cmpxchg_u)
+{
+    if (interpreter.atomic_compare_exchange<i64, u8>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_cmpxchg_u)
+{
+    if (interpreter.atomic_compare_exchange<i64, u16>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_cmpxchg_u)
+{
+    if (interpreter.atomic_compare_exchange<i64, u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
 template<u64 opcode, bool HasDynamicInsnLimit, typename Continue, typename... Args>
 constexpr static auto handle_instruction(Args&&... a)
 {
@@ -4170,6 +4640,189 @@ bool BytecodeInterpreter::store_to_memory(Configuration& configuration, Instruct
     return store_to_memory(*memory, instance_address, data);
 }
 
+template<typename AccessT>
+AccessT volatile* BytecodeInterpreter::atomic_access(Configuration& configuration, Instruction::MemoryArgument const& arg, u32 base)
+{
+    auto const& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
+    auto memory = configuration.store().get(address);
+    u64 instance_address = static_cast<u64>(base) + arg.offset;
+    if (instance_address + sizeof(AccessT) > memory->size()) [[unlikely]] {
+        m_trap = Trap::from_string("Memory access out of bounds");
+        dbgln_if(WASM_TRACE_DEBUG, "LibWasm: Atomic memory access out of bounds (expected {} to be less than or equal to {})", instance_address + sizeof(AccessT), memory->size());
+        return nullptr;
+    }
+    // https://webassembly.github.io/threads/core/exec/instructions.html#atomic-memory-instructions
+    // If ea modulo N/8 is not equal to 0, then trap.
+    if (instance_address % sizeof(AccessT) != 0) [[unlikely]] {
+        m_trap = Trap::from_string("Unaligned atomic memory access");
+        return nullptr;
+    }
+    return bit_cast<AccessT volatile*>(memory->data().offset_pointer(instance_address));
+}
+
+template<typename AccessT, typename PushT>
+bool BytecodeInterpreter::atomic_load_and_push(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto& entry = configuration.source_value(0, addresses.sources); // bounds checked by verifier.
+    auto pointer = atomic_access<AccessT>(configuration, arg, entry.to<u32>());
+    if (!pointer)
+        return true;
+    entry = Value(static_cast<PushT>(AK::atomic_load(pointer)));
+    return false;
+}
+
+template<typename PopT, typename AccessT>
+bool BytecodeInterpreter::atomic_pop_and_store(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    // bounds checked by verifier.
+    auto value = static_cast<AccessT>(configuration.take_source(0, addresses.sources).to<PopT>());
+    auto base = configuration.take_source(1, addresses.sources).to<u32>();
+    auto pointer = atomic_access<AccessT>(configuration, arg, base);
+    if (!pointer)
+        return true;
+    AK::atomic_store(pointer, value);
+    return false;
+}
+
+template<typename ValueT, typename AccessT, typename Operator>
+bool BytecodeInterpreter::atomic_read_modify_write(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    // bounds checked by verifier.
+    auto operand = static_cast<AccessT>(configuration.take_source(0, addresses.sources).to<ValueT>());
+    auto base = configuration.take_source(1, addresses.sources).to<u32>();
+    auto pointer = atomic_access<AccessT>(configuration, arg, base);
+    if (!pointer)
+        return true;
+    auto previous = Operator {}(pointer, operand);
+    dbgln_if(WASM_TRACE_DEBUG, "{}({}) -> {}", Operator::name(), operand, previous);
+    configuration.push_to_destination(Value(static_cast<ValueT>(previous)), addresses.destination);
+    return false;
+}
+
+template<typename ValueT, typename AccessT>
+bool BytecodeInterpreter::atomic_compare_exchange(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    // bounds checked by verifier.
+    auto replacement = static_cast<AccessT>(configuration.take_source(0, addresses.sources).to<ValueT>());
+    auto expected = static_cast<AccessT>(configuration.take_source(1, addresses.sources).to<ValueT>());
+    auto base = configuration.take_source(2, addresses.sources).to<u32>();
+    auto pointer = atomic_access<AccessT>(configuration, arg, base);
+    if (!pointer)
+        return true;
+    // On failure, `expected` is updated to the value that was read, which is exactly what we need to push.
+    (void)AK::atomic_compare_exchange_strong(pointer, expected, replacement);
+    configuration.push_to_destination(Value(static_cast<ValueT>(expected)), addresses.destination);
+    return false;
+}
+
+// A thread parked in memory.atomic.wait until another one notifies the same location of the same shared memory.
+struct AtomicWaiter {
+    u64 address { 0 };
+    Threading::ConditionVariable condition;
+    bool notified { false };
+};
+
+// https://webassembly.github.io/threads/core/exec/instructions.html#exec-memory-atomic-wait
+template<typename ExpectedT>
+bool BytecodeInterpreter::atomic_wait(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    using AccessT = MakeUnsigned<ExpectedT>;
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    // bounds checked by verifier.
+    auto timeout = configuration.take_source(0, addresses.sources).to<i64>();
+    auto expected = static_cast<AccessT>(configuration.take_source(1, addresses.sources).to<ExpectedT>());
+    auto base = configuration.take_source(2, addresses.sources).to<u32>();
+
+    auto const& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
+    auto memory = configuration.store().get(address);
+    auto* atomic_waiters = memory->atomic_waiters();
+    if (!atomic_waiters)
+        return set_trap("Atomic wait on unshared memory"sv);
+
+    auto pointer = atomic_access<AccessT>(configuration, arg, base);
+    if (!pointer)
+        return true;
+
+    enum class WaitResult : i32 {
+        Ok = 0,
+        NotEqual = 1,
+        TimedOut = 2,
+    };
+
+    // NOTE: The value is compared with the waiters locked, so that a notify following a store can't slip in between.
+    Threading::MutexLocker locker(atomic_waiters->mutex);
+    if (AK::atomic_load(pointer) != expected) {
+        configuration.push_to_destination(Value(to_underlying(WaitResult::NotEqual)), addresses.destination);
+        return false;
+    }
+
+    // FIXME: Shared memories are only ever reachable from the agent that created them, so nothing could ever notify a
+    //        wait without a timeout. Trap instead of blocking that agent forever, until memories can be shared with
+    //        workers.
+    if (timeout < 0)
+        return set_trap("Atomic wait without a timeout on a memory no other agent can notify"sv);
+
+    AtomicWaiter waiter { .address = static_cast<u64>(base) + arg.offset, .condition = Threading::ConditionVariable { atomic_waiters->mutex }, .notified = false };
+    atomic_waiters->waiters.append(&waiter);
+
+    auto deadline = UnixDateTime::now() + AK::Duration::from_nanoseconds(timeout);
+    while (!waiter.notified && waiter.condition.wait_until(deadline))
+        ;
+
+    auto result = WaitResult::Ok;
+    if (!waiter.notified) {
+        atomic_waiters->waiters.remove_first_matching([&](auto* other) { return other == &waiter; });
+        result = WaitResult::TimedOut;
+    }
+
+    configuration.push_to_destination(Value(to_underlying(result)), addresses.destination);
+    return false;
+}
+
+// https://webassembly.github.io/threads/core/exec/instructions.html#exec-memory-atomic-notify
+bool BytecodeInterpreter::atomic_notify(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    // bounds checked by verifier.
+    auto count = configuration.take_source(0, addresses.sources).to<u32>();
+    auto base = configuration.take_source(1, addresses.sources).to<u32>();
+    if (!atomic_access<u32>(configuration, arg, base))
+        return true;
+
+    auto const& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
+    auto memory = configuration.store().get(address);
+
+    // NOTE: Unshared memories can't have waiters, since waiting on them traps.
+    auto* atomic_waiters = memory->atomic_waiters();
+    if (!atomic_waiters) {
+        configuration.push_to_destination(Value(static_cast<i32>(0)), addresses.destination);
+        return false;
+    }
+
+    auto notified_address = static_cast<u64>(base) + arg.offset;
+    u32 woken_count = 0;
+    Threading::MutexLocker locker(atomic_waiters->mutex);
+    auto& waiters = atomic_waiters->waiters;
+    for (size_t i = 0; i < waiters.size() && woken_count < count;) {
+        auto& waiter = *waiters[i];
+        if (waiter.address != notified_address) {
+            ++i;
+            continue;
+        }
+        waiters.remove(i);
+        waiter.notified = true;
+        waiter.condition.signal();
+        ++woken_count;
+    }
+
+    configuration.push_to_destination(Value(static_cast<i32>(woken_count)), addresses.destination);
+    return false;
+}
+
 template<typename T>
 bool BytecodeInterpreter::store_to_memory(MemoryInstance& memory, u64 address, T value)
 {
@@ -96,6 +96,19 @@ struct WASM_API BytecodeInterpreter final : public Interpreter {
     template<typename M, template<typename> typename SetSign, typename VectorType = Native128ByteVectorOf<M, SetSign>>
     VectorType pop_vector(Configuration&, size_t source, SourcesAndDestination const&);
     bool store_to_memory(Configuration&, Instruction::MemoryArgument const&, ReadonlyBytes data, u32 base);
+    template<typename AccessT>
+    AccessT volatile* atomic_access(Configuration&, Instruction::MemoryArgument const&, u32 base);
+    template<typename AccessT, typename PushT>
+    bool atomic_load_and_push(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename PopT, typename AccessT>
+    bool atomic_pop_and_store(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename ValueT, typename AccessT, typename Operator>
+    bool atomic_read_modify_write(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename ValueT, typename AccessT>
+    bool atomic_compare_exchange(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename ExpectedT>
+    bool atomic_wait(Configuration&, Instruction const&, SourcesAndDestination const&);
+    bool atomic_notify(Configuration&, Instruction const&, SourcesAndDestination const&);
     Outcome call_address(Configuration&, FunctionAddress, CallAddressSource = CallAddressSource::DirectCall);
 
     template<typename T>
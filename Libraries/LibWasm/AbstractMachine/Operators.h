@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/BitCast.h>
 #include <AK/BuiltinWrappers.h>
 #include <AK/Math.h>
@@ -51,6 +52,29 @@ DEFINE_BINARY_OPERATOR(BitXor, ^);
 
 #undef DEFINE_BINARY_OPERATOR
 
+#define DEFINE_ATOMIC_READ_MODIFY_WRITE_OPERATOR(Name, function, operation) \
+    struct Name {                                                         \
+        template<typename T>                                              \
+        T operator()(T volatile* pointer, T value) const                  \
+        {                                                                 \
+            return AK::function(pointer, value);                          \
+        }                                                                 \
+                                                                          \
+        static StringView name()                                          \
+        {                                                                 \
+            return operation##sv;                                         \
+        }                                                                 \
+    }
+
+DEFINE_ATOMIC_READ_MODIFY_WRITE_OPERATOR(AtomicAdd, atomic_fetch_add, "atomic.add");
+DEFINE_ATOMIC_READ_MODIFY_WRITE_OPERATOR(AtomicSubtract, atomic_fetch_sub, "atomic.sub");
+DEFINE_ATOMIC_READ_MODIFY_WRITE_OPERATOR(AtomicAnd, atomic_fetch_and, "atomic.and");
+DEFINE_ATOMIC_READ_MODIFY_WRITE_OPERATOR(AtomicOr, atomic_fetch_or, "atomic.or");
+DEFINE_ATOMIC_READ_MODIFY_WRITE_OPERATOR(AtomicXor, atomic_fetch_xor, "atomic.xor");
+DEFINE_ATOMIC_READ_MODIFY_WRITE_OPERATOR(AtomicExchange, atomic_exchange, "atomic.xchg");
+
+#undef DEFINE_ATOMIC_READ_MODIFY_WRITE_OPERATOR
+
 struct Identity {
     auto operator()(auto x) const { return x; }
 };
@@ -284,6 +284,11 @@ ErrorOr<void, ValidationError> Validator::validate(TableType const& type)
 ErrorOr<void, ValidationError> Validator::validate(MemoryType const& type)
 {
     u64 bound = type.limits().address_type() == AddressType::I64 ? 1ull << 48 : 1ull << 16;
+
+    // Proposal 'threads': shared memories must declare a maximum size.
+    if (type.limits().is_shared() && !type.limits().max().has_value())
+        return Errors::invalid("shared memory without a maximum size"sv);
+
     return validate(type.limits(), bound);
 }
 
@@ -3995,6 +4000,783 @@ VALIDATE_INSTRUCTION(i32x4_relaxed_dot_i8x16_i7x16_add_s)
     return stack.take_and_put<ValueType::V128, ValueType::V128, ValueType::V128>(ValueType::V128);
 }
 
+// https://webassembly.github.io/threads/core/valid/instructions.html#atomic-memory-instructions
+VALIDATE_INSTRUCTION(memory_atomic_notify)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(memory_atomic_wait32)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(memory_atomic_wait64)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i64)));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(atomic_fence)
+{
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 64 / 8));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load8_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load16_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load8_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load16_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load32_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 64 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store8)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store16)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store8)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store16)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store32)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_add)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_add)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 64 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_sub)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_sub)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 64 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_and)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_and)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 64 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_or)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_or)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 64 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_xor)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_xor)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 64 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_xchg)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_xchg)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 64 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_cmpxchg)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_cmpxchg)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 64 / 8));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I32, ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 8 / 8));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 16 / 8));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, 32 / 8));
+
+    TRY((stack.take<ValueType::I64, ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
 VALIDATE_INSTRUCTION(synthetic_end_expression)
 {
     is_constant = true;
@@ -318,6 +318,17 @@ public:
         return {};
     }
 
+    ErrorOr<MemoryType, ValidationError> validate_atomic_memory_argument(Instruction::MemoryArgument const& arg, size_t access_size)
+    {
+        auto memory = TRY(validate(arg.memory_index));
+
+        // Proposal 'threads': atomic accesses must be naturally aligned.
+        if ((1ull << arg.align) != access_size)
+            return Errors::invalid("atomic memory op alignment"sv, access_size, 1ull << arg.align);
+
+        return memory;
+    }
+
 private:
     explicit Validator(Context context)
         : m_context(move(context))
@@ -0,0 +1,36 @@
+test("atomic read-modify-write instructions operate on shared memory", () => {
+    const bin = readBinaryWasmFile("Fixtures/Modules/atomics-shared-memory.wasm");
+    const module = parseWebAssemblyModule(bin);
+
+    // store 40, rmw.add 2, rmw.cmpxchg 42 -> 100, fence, load
+    const go = module.getExport("go");
+    expect(module.invoke(go)).toBe(100);
+});
+
+test("memory.atomic.wait32 reports not-equal and notify wakes nobody", () => {
+    const bin = readBinaryWasmFile("Fixtures/Modules/atomics-shared-memory.wasm");
+    const module = parseWebAssemblyModule(bin);
+
+    const wait = module.getExport("wait");
+    expect(module.invoke(wait)).toBe(1);
+
+    const notify = module.getExport("notify");
+    expect(module.invoke(notify)).toBe(0);
+});
+
+test("memory.atomic.wait32 times out when nobody notifies", () => {
+    const bin = readBinaryWasmFile("Fixtures/Modules/atomics-shared-memory.wasm");
+    const module = parseWebAssemblyModule(bin);
+
+    // Waits on a zero for a millisecond.
+    const timedWait = module.getExport("timed_wait");
+    expect(module.invoke(timedWait)).toBe(2);
+});
+
+test("memory.atomic.wait32 without a timeout traps instead of blocking forever", () => {
+    const bin = readBinaryWasmFile("Fixtures/Modules/atomics-shared-memory.wasm");
+    const module = parseWebAssemblyModule(bin);
+
+    const waitForever = module.getExport("wait_forever");
+    expect(() => module.invoke(waitForever)).toThrow(TypeError);
+});
@@ -259,10 +259,16 @@ enum class AddressType : u8 {
 // https://webassembly.github.io/spec/core/bikeshed/#limits%E2%91%A5
 class Limits {
 public:
-    explicit Limits(AddressType address_type, u64 min, Optional<u64> max = {})
+    enum class Shared : u8 {
+        No,
+        Yes,
+    };
+
+    explicit Limits(AddressType address_type, u64 min, Optional<u64> max = {}, Shared shared = Shared::No)
         : m_address_type(address_type)
         , m_min(min)
         , m_max(move(max))
+        , m_shared(shared)
     {
     }
 
@@ -273,11 +279,14 @@ public:
     auto address_type() const { return m_address_type; }
     auto min() const { return m_min; }
     auto& max() const { return m_max; }
+    auto shared() const { return m_shared; }
+    bool is_shared() const { return m_shared == Shared::Yes; }
     bool is_subset_of(Limits other) const
     {
         return m_min >= other.min()
             && (!other.max().has_value() || (m_max.has_value() && *m_max <= *other.max()))
-            && m_address_type == other.m_address_type;
+            && m_address_type == other.m_address_type
+            && m_shared == other.m_shared;
     }
 
     static ParseResult<Limits> parse(ConstrainedStream& stream);
@@ -286,6 +295,7 @@ private:
     AddressType m_address_type { AddressType::I32 };
     u64 m_min { 0 };
     Optional<u64> m_max;
+    Shared m_shared { Shared::No };
 };
 
 // https://webassembly.github.io/spec/core/bikeshed/#memory-types%E2%91%A4
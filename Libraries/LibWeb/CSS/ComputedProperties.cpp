@@ -48,10 +48,93 @@ namespace Web::CSS {
 
 GC_DEFINE_ALLOCATOR(ComputedProperties);
 
-ComputedProperties::ComputedProperties() = default;
+struct PropertyValueSlot {
+    u16 group { 0 };
+    u16 index { 0 };
+};
+
+struct ComputedProperties::PropertyValueLayout {
+    Array<PropertyValueSlot, number_of_longhand_properties> slots;
+    size_t inherited_group_count { 0 };
+    size_t group_count { 0 };
+};
+
+ComputedProperties::PropertyValueLayout const& ComputedProperties::property_value_layout()
+{
+    static PropertyValueLayout const layout = [] {
+        PropertyValueLayout result;
+        size_t inherited_count = 0;
+        for (auto i = to_underlying(first_longhand_property_id); i <= to_underlying(last_longhand_property_id); ++i) {
+            if (is_inherited_property(static_cast<PropertyID>(i)))
+                ++inherited_count;
+        }
+        result.inherited_group_count = ceil_div(inherited_count, property_value_group_size);
+
+        size_t next_inherited = 0;
+        size_t next_non_inherited = result.inherited_group_count * property_value_group_size;
+        for (auto i = to_underlying(first_longhand_property_id); i <= to_underlying(last_longhand_property_id); ++i) {
+            auto& position = is_inherited_property(static_cast<PropertyID>(i)) ? next_inherited : next_non_inherited;
+            result.slots[i - to_underlying(first_longhand_property_id)] = { static_cast<u16>(position / property_value_group_size), static_cast<u16>(position % property_value_group_size) };
+            ++position;
+        }
+        result.group_count = ceil_div(next_non_inherited, property_value_group_size);
+        VERIFY(result.group_count <= max_property_value_group_count);
+        return result;
+    }();
+    return layout;
+}
+
+ComputedProperties::PropertyValueGroups const& ComputedProperties::empty_property_value_groups()
+{
+    static PropertyValueGroups const groups = PropertyValueGroups::from_repeated_value(adopt_ref(*new PropertyValueGroup));
+    return groups;
+}
+
+ComputedProperties::PropertyValueGroups const& ComputedProperties::initial_property_value_groups()
+{
+    static PropertyValueGroups const groups = [] {
+        auto result = empty_property_value_groups();
+        auto const& layout = property_value_layout();
+        for (auto i = layout.inherited_group_count; i < layout.group_count; ++i)
+            result[i] = adopt_ref(*new PropertyValueGroup);
+
+        for (auto i = to_underlying(first_longhand_property_id); i <= to_underlying(last_longhand_property_id); ++i) {
+            auto property_id = static_cast<PropertyID>(i);
+            if (is_inherited_property(property_id))
+                continue;
+            auto slot = layout.slots[i - to_underlying(first_longhand_property_id)];
+            result[slot.group]->values[slot.index] = property_initial_value(property_id);
+        }
+        return result;
+    }();
+    return groups;
+}
+
+ComputedProperties::ComputedProperties()
+    : m_property_value_groups(empty_property_value_groups())
+{
+}
 
 ComputedProperties::~ComputedProperties() = default;
 
+GC::Ref<ComputedProperties> ComputedProperties::clone() const
+{
+    auto clone = heap().allocate<ComputedProperties>();
+    clone->m_transition_property_source = m_transition_property_source;
+    clone->m_property_value_groups = m_property_value_groups;
+    clone->m_property_important = m_property_important;
+    clone->m_property_inherited = m_property_inherited;
+    clone->m_animated_property_inherited = m_animated_property_inherited;
+    clone->m_animated_property_values = m_animated_property_values;
+    clone->m_display_before_box_type_transformation = m_display_before_box_type_transformation;
+    clone->m_math_depth = m_math_depth;
+    clone->m_font_list = m_font_list;
+    clone->m_first_available_computed_font = m_first_available_computed_font;
+    clone->m_line_height = m_line_height;
+    clone->m_attempted_pseudo_class_matches = m_attempted_pseudo_class_matches;
+    return clone;
+}
+
 void ComputedProperties::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -128,14 +211,54 @@ void ComputedProperties::set_property_without_modifying_flags(PropertyID id, Non
 {
     VERIFY(id >= first_longhand_property_id && id <= last_longhand_property_id);
 
-    m_property_values[to_underlying(id) - to_underlying(first_longhand_property_id)] = move(value);
+    set_stored_property_value(id, move(value));
+}
+
+RefPtr<StyleValue const> const& ComputedProperties::stored_property_value(PropertyID id) const
+{
+    auto slot = property_value_layout().slots[to_underlying(id) - to_underlying(first_longhand_property_id)];
+    return m_property_value_groups[slot.group]->values[slot.index];
+}
+
+void ComputedProperties::set_stored_property_value(PropertyID id, RefPtr<StyleValue const> value)
+{
+    auto slot = property_value_layout().slots[to_underlying(id) - to_underlying(first_longhand_property_id)];
+    auto& group = m_property_value_groups[slot.group];
+    auto const& current_value = group->values[slot.index];
+    if (current_value == value)
+        return;
+
+    if (group->ref_count() > 1) {
+        // NOTE: Computing a style rewrites most values with freshly created but identical ones, so only stop sharing
+        //       the group if the value actually changes.
+        if (current_value && value && *current_value == *value)
+            return;
+        auto copy = adopt_ref(*new PropertyValueGroup);
+        copy->values = group->values;
+        group = move(copy);
+    }
+    group->values[slot.index] = move(value);
+}
+
+void ComputedProperties::share_inherited_property_values_with(ComputedProperties const& other)
+{
+    for (size_t i = 0; i < property_value_layout().inherited_group_count; ++i)
+        m_property_value_groups[i] = other.m_property_value_groups[i];
+}
+
+void ComputedProperties::set_non_inherited_properties_to_initial_values()
+{
+    auto const& layout = property_value_layout();
+    auto const& initial_groups = initial_property_value_groups();
+    for (auto i = layout.inherited_group_count; i < layout.group_count; ++i)
+        m_property_value_groups[i] = initial_groups[i];
 }
 
 void ComputedProperties::revert_property(PropertyID id, ComputedProperties const& style_for_revert)
 {
     VERIFY(id >= first_longhand_property_id && id <= last_longhand_property_id);
 
-    m_property_values[to_underlying(id) - to_underlying(first_longhand_property_id)] = style_for_revert.m_property_values[to_underlying(id) - to_underlying(first_longhand_property_id)];
+    set_stored_property_value(id, style_for_revert.stored_property_value(id));
     set_property_important(id, style_for_revert.is_property_important(id) ? Important::Yes : Important::No);
     set_property_inherited(id, style_for_revert.is_property_inherited(id) ? Inherited::Yes : Inherited::No);
 }
@@ -180,7 +303,7 @@ StyleValue const& ComputedProperties::property(PropertyID property_id, WithAnima
     }
 
     // By the time we call this method, all properties have values assigned.
-    return *m_property_values[to_underlying(property_id) - to_underlying(first_longhand_property_id)];
+    return *stored_property_value(property_id);
 }
 
 Variant<LengthPercentage, NormalGap> ComputedProperties::gap_value(PropertyID id) const
@@ -868,9 +991,11 @@ Positioning ComputedProperties::position() const
 
 bool ComputedProperties::operator==(ComputedProperties const& other) const
 {
-    for (size_t i = 0; i < m_property_values.size(); ++i) {
-        auto const& my_style = m_property_values[i];
-        auto const& other_style = other.m_property_values[i];
+    for (auto i = to_underlying(first_longhand_property_id); i <= to_underlying(last_longhand_property_id); ++i) {
+        auto const& my_style = stored_property_value(static_cast<PropertyID>(i));
+        auto const& other_style = other.stored_property_value(static_cast<PropertyID>(i));
+        if (my_style == other_style)
+            continue;
         if (!my_style) {
             if (other_style)
                 return false;
@@ -9,6 +9,7 @@
 
 #include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Ptr.h>
 #include <LibGfx/Font/Font.h>
@@ -35,15 +36,25 @@ public:
 
     virtual ~ComputedProperties() override;
 
+    // Returns a new ComputedProperties with the same values, which can then be adjusted independently of this one.
+    [[nodiscard]] GC::Ref<ComputedProperties> clone() const;
+
     template<typename Callback>
     inline void for_each_property(Callback callback) const
     {
-        for (size_t i = 0; i < m_property_values.size(); ++i) {
-            if (m_property_values[i])
-                callback(static_cast<PropertyID>(i + to_underlying(first_longhand_property_id)), *m_property_values[i]);
+        for (auto i = to_underlying(first_longhand_property_id); i <= to_underlying(last_longhand_property_id); ++i) {
+            auto property_id = static_cast<PropertyID>(i);
+            if (auto const& value = stored_property_value(property_id))
+                callback(property_id, *value);
         }
     }
 
+    // Makes the inherited properties share their values with `other` until one of the two changes them.
+    void share_inherited_property_values_with(ComputedProperties const& other);
+
+    // Gives every non-inherited property its initial value, shared with all other ComputedProperties until changed.
+    void set_non_inherited_properties_to_initial_values();
+
     enum class Inherited {
         No,
         Yes
@@ -293,7 +304,29 @@ private:
 
     GC::Ptr<CSSStyleDeclaration const> m_transition_property_source;
 
-    Array<RefPtr<StyleValue const>, number_of_longhand_properties> m_property_values;
+    // Property values are stored in small groups that are shared by pointer between ComputedProperties whenever they
+    // hold the same values, which is common for inherited properties (most elements don't set any themselves) and for
+    // rarely used non-inherited ones (grid, mask, etc.) that stay at their initial values. A shared group is copied the
+    // first time one of its values is changed. Each group holds either only inherited or only non-inherited properties,
+    // in PropertyID order, so related properties like background-* tend to end up together.
+    static constexpr size_t property_value_group_size = 16;
+    static constexpr size_t max_property_value_group_count = ceil_div(number_of_longhand_properties, property_value_group_size) + 1;
+
+    struct PropertyValueGroup : public RefCounted<PropertyValueGroup> {
+        Array<RefPtr<StyleValue const>, property_value_group_size> values;
+    };
+
+    // NOTE: Every entry is non-null; groups past the ones in use simply stay empty.
+    using PropertyValueGroups = Array<RefPtr<PropertyValueGroup>, max_property_value_group_count>;
+    struct PropertyValueLayout;
+    static PropertyValueLayout const& property_value_layout();
+    static PropertyValueGroups const& empty_property_value_groups();
+    static PropertyValueGroups const& initial_property_value_groups();
+
+    RefPtr<StyleValue const> const& stored_property_value(PropertyID) const;
+    void set_stored_property_value(PropertyID, RefPtr<StyleValue const>);
+
+    PropertyValueGroups m_property_value_groups;
     Array<u8, ceil_div(number_of_longhand_properties, 8uz)> m_property_important {};
     Array<u8, ceil_div(number_of_longhand_properties, 8uz)> m_property_inherited {};
     Array<u8, ceil_div(number_of_longhand_properties, 8uz)> m_animated_property_inherited {};
@@ -61,6 +61,12 @@ Parser Parser::create(ParsingParams const& context, StringView input, StringView
     return Parser { context, move(tokens) };
 }
 
+Parser Parser::create(ParsingParams const& context, String const& input)
+{
+    auto tokens = Tokenizer::tokenize(input);
+    return Parser { context, move(tokens) };
+}
+
 Parser::Parser(ParsingParams const& context, Vector<Token> tokens)
     : m_document(context.document)
     , m_realm(context.realm)
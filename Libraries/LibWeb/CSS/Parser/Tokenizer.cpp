@@ -5,7 +5,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BitCast.h>
 #include <AK/Debug.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/SourceLocation.h>
 #include <AK/StringConversions.h>
 #include <AK/Vector.h>
@@ -155,66 +158,120 @@ static inline bool is_E(u32 code_point)
     return code_point == 0x45;
 }
 
-Vector<Token> Tokenizer::tokenize(StringView input, StringView encoding)
+// Returns how many bytes at the start of `bytes` satisfy `predicate`. The predicate is written once in terms of
+// comparisons and bitwise operators, so that it can be evaluated on 16 bytes at a time to get through long runs
+// quickly, and then on single bytes for the remainder.
+template<typename Predicate>
+static size_t count_leading_bytes_matching(ReadonlyBytes bytes, Predicate predicate)
 {
-    // https://www.w3.org/TR/css-syntax-3/#css-filter-code-points
-    auto filter_code_points = [](StringView input, auto encoding) -> String {
-        auto decoder = TextCodec::decoder_for(encoding);
-        VERIFY(decoder.has_value());
-
-        auto decoded_input = MUST(decoder->to_utf8(input));
-
-        // OPTIMIZATION: If the input doesn't contain any filterable characters, we can skip the filtering
-        bool const contains_filterable = [&] {
-            for (auto code_point : decoded_input.code_points()) {
-                if (code_point == '\r' || code_point == '\f' || code_point == 0x00 || is_unicode_surrogate(code_point))
-                    return true;
-            }
-            return false;
-        }();
-        if (!contains_filterable) {
-            return decoded_input;
-        }
+    using AK::SIMD::u8x16;
 
-        StringBuilder builder { input.length() };
-        bool last_was_carriage_return = false;
-
-        // To filter code points from a stream of (unfiltered) code points input:
-        for (auto code_point : decoded_input.code_points()) {
-            // Replace any U+000D CARRIAGE RETURN (CR) code points,
-            // U+000C FORM FEED (FF) code points,
-            // or pairs of U+000D CARRIAGE RETURN (CR) followed by U+000A LINE FEED (LF)
-            // in input by a single U+000A LINE FEED (LF) code point.
-            if (code_point == '\r') {
-                if (last_was_carriage_return) {
-                    builder.append('\n');
-                } else {
-                    last_was_carriage_return = true;
-                }
-            } else {
-                if (last_was_carriage_return)
-                    builder.append('\n');
+    size_t offset = 0;
+    for (; offset + sizeof(u8x16) <= bytes.size(); offset += sizeof(u8x16)) {
+        auto chunk = AK::SIMD::load_unaligned<u8x16>(bytes.offset_pointer(offset));
+        auto lanes = bit_cast<Array<u64, 2>>(predicate(chunk));
+        if ((lanes[0] & lanes[1]) != NumericLimits<u64>::max())
+            break;
+    }
+    for (; offset < bytes.size(); ++offset) {
+        if (!predicate(bytes[offset]))
+            break;
+    }
+    return offset;
+}
+
+// A byte of a run of whitespace. These are all the whitespace code points that remain after filtering the input.
+static constexpr auto is_whitespace_byte = [](auto c) {
+    return (c == '\n') | (c == '\t') | (c == ' ');
+};
+
+// A byte of a run of name code points that contains no escapes: an ASCII letter, digit, U+005F LOW LINE (_) or
+// U+002D HYPHEN-MINUS (-), or any byte of a non-ASCII code point.
+static constexpr auto is_name_byte = [](auto c) {
+    return ((c >= 'a') & (c <= 'z')) | ((c >= 'A') & (c <= 'Z')) | ((c >= '0') & (c <= '9')) | (c == '_') | (c == '-') | (c >= 0x80);
+};
+
+// A byte of a run of an unquoted url's value that contains no escapes and nothing that would end or invalidate it.
+static constexpr auto is_url_byte = [](auto c) {
+    return (c > ' ') & (c != 0x7F) & (c != '"') & (c != '\'') & (c != '(') & (c != ')') & (c != '\\');
+};
 
-                if (code_point == '\n') {
-                    if (!last_was_carriage_return)
-                        builder.append('\n');
+// https://www.w3.org/TR/css-syntax-3/#css-filter-code-points
+static String filter_code_points(String const& input)
+{
+    // OPTIMIZATION: If the input doesn't contain any filterable characters, we can skip the filtering.
+    //               CR, FF and NULL are single bytes in UTF-8, and every surrogate is encoded as 0xED followed by a
+    //               byte of 0xA0 or more, so we can look for them without decoding the input.
+    bool const contains_filterable = [&] {
+        auto bytes = input.bytes();
+        for (size_t i = 0; i < bytes.size(); ++i) {
+            auto byte = bytes[i];
+            if (byte == '\r' || byte == '\f' || byte == 0x00)
+                return true;
+            if (byte == 0xED && i + 1 < bytes.size() && bytes[i + 1] >= 0xA0)
+                return true;
+        }
+        return false;
+    }();
+    if (!contains_filterable)
+        return input;
+
+    StringBuilder builder { input.bytes().size() };
+    bool last_was_carriage_return = false;
+
+    // To filter code points from a stream of (unfiltered) code points input:
+    for (auto code_point : input.code_points()) {
+        // Replace any U+000D CARRIAGE RETURN (CR) code points,
+        // U+000C FORM FEED (FF) code points,
+        // or pairs of U+000D CARRIAGE RETURN (CR) followed by U+000A LINE FEED (LF)
+        // in input by a single U+000A LINE FEED (LF) code point.
+        if (code_point == '\r') {
+            if (last_was_carriage_return) {
+                builder.append('\n');
+            } else {
+                last_was_carriage_return = true;
+            }
+        } else {
+            if (last_was_carriage_return)
+                builder.append('\n');
 
-                } else if (code_point == '\f') {
+            if (code_point == '\n') {
+                if (!last_was_carriage_return)
                     builder.append('\n');
-                    // Replace any U+0000 NULL or surrogate code points in input with U+FFFD REPLACEMENT CHARACTER (�).
-                } else if (code_point == 0x00 || is_unicode_surrogate(code_point)) {
-                    builder.append_code_point(REPLACEMENT_CHARACTER);
-                } else {
-                    builder.append_code_point(code_point);
-                }
-
-                last_was_carriage_return = false;
+
+            } else if (code_point == '\f') {
+                builder.append('\n');
+                // Replace any U+0000 NULL or surrogate code points in input with U+FFFD REPLACEMENT CHARACTER (�).
+            } else if (code_point == 0x00 || is_unicode_surrogate(code_point)) {
+                builder.append_code_point(REPLACEMENT_CHARACTER);
+            } else {
+                builder.append_code_point(code_point);
             }
+
+            last_was_carriage_return = false;
         }
-        return builder.to_string_without_validation();
-    };
+    }
+    return builder.to_string_without_validation();
+}
+
+Vector<Token> Tokenizer::tokenize(StringView input, StringView encoding)
+{
+    auto decoder = TextCodec::decoder_for(encoding);
+    VERIFY(decoder.has_value());
+
+    auto decoded_input = MUST(decoder->to_utf8(input));
 
-    Tokenizer tokenizer { filter_code_points(input, encoding) };
+    Tokenizer tokenizer { filter_code_points(decoded_input) };
+    return tokenizer.tokenize();
+}
+
+Vector<Token> Tokenizer::tokenize(String const& input)
+{
+    // NOTE: Decoding as UTF-8 would strip a leading BOM, so leave that rare case to the general path.
+    if (input.bytes().starts_with({ { 0xEF, 0xBB, 0xBF } }))
+        return tokenize(input.bytes_as_string_view(), "utf-8"sv);
+
+    Tokenizer tokenizer { filter_code_points(input) };
     return tokenizer.tokenize();
 }
 
@@ -542,8 +599,15 @@ FlyString Tokenizer::consume_an_ident_sequence()
     // If that is the intended use, ensure that the stream starts with an ident sequence before
     // calling this algorithm.
 
+    // OPTIMIZATION: Consume the leading run of name code points without escapes all at once. Unless it's followed by
+    //               an escape, that's the whole name, and we can use it without copying it into a builder.
+    auto plain_name = consume_bytes(count_leading_bytes_matching(remaining_bytes(), is_name_byte));
+    if (!is_reverse_solidus(peek_code_point()))
+        return FlyString::from_utf8_without_validation(plain_name.bytes());
+
     // Let result initially be an empty string.
     StringBuilder result;
+    result.append(plain_name);
 
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
@@ -594,6 +658,16 @@ Token Tokenizer::consume_a_url_token()
     // 2. Consume as much whitespace as possible.
     consume_as_much_whitespace_as_possible();
 
+    // OPTIMIZATION: Most urls are a single run of code points that need no special handling, directly followed by
+    //               U+0029 RIGHT PARENTHESIS ()). Consume that run all at once, and use it without copying it into a
+    //               builder if nothing else follows.
+    auto plain_url = consume_bytes(count_leading_bytes_matching(remaining_bytes(), is_url_byte));
+    if (is_right_paren(peek_code_point())) {
+        (void)next_code_point();
+        return Token::create_url(FlyString::from_utf8_without_validation(plain_url.bytes()), input_since(start_byte_offset));
+    }
+    builder.append(plain_url);
+
     // 3. Repeatedly consume the next input code point from the stream:
     for (;;) {
         auto input = next_code_point();
@@ -703,9 +777,7 @@ void Tokenizer::consume_the_remnants_of_a_bad_url()
 
 void Tokenizer::consume_as_much_whitespace_as_possible()
 {
-    while (is_whitespace(peek_code_point())) {
-        (void)next_code_point();
-    }
+    (void)consume_bytes(count_leading_bytes_matching(remaining_bytes(), is_whitespace_byte));
 }
 
 void Tokenizer::reconsume_current_input_code_point()
@@ -873,7 +945,19 @@ Token Tokenizer::consume_string_token(u32 ending_code_point)
 
     // Initially create a <string-token> with its value set to the empty string.
     auto original_source_text_start_byte_offset_including_quotation_mark = current_byte_offset() - 1;
+
+    // OPTIMIZATION: Consume the leading run of code points that are appended to the value as-is all at once. If the
+    //               ending code point comes right after it, we can use it without copying it into a builder.
+    auto plain_string = consume_bytes(count_leading_bytes_matching(remaining_bytes(), [ending = static_cast<u8>(ending_code_point)](auto c) {
+        return (c != ending) & (c != '\\') & (c != '\n');
+    }));
+    if (peek_code_point() == ending_code_point) {
+        (void)next_code_point();
+        return Token::create_string(FlyString::from_utf8_without_validation(plain_string.bytes()), input_since(original_source_text_start_byte_offset_including_quotation_mark));
+    }
+
     StringBuilder builder;
+    builder.append(plain_string);
 
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
@@ -946,6 +1030,12 @@ start:
     (void)next_code_point();
 
     for (;;) {
+        // OPTIMIZATION: Skip ahead to the next U+002A ASTERISK (*), if there is one. (If there isn't, we leave the
+        //               rest of the input to the loop below, which stops just short of the end.)
+        auto bytes_before_asterisk = count_leading_bytes_matching(remaining_bytes(), [](auto c) { return c != '*'; });
+        if (bytes_before_asterisk < remaining_bytes().size())
+            (void)consume_bytes(bytes_before_asterisk);
+
         auto twin_inner = peek_twin();
         if (is_eof(twin_inner.first) || is_eof(twin_inner.second)) {
             log_parse_error();
@@ -1238,4 +1328,39 @@ String Tokenizer::input_since(size_t offset) const
     return MUST(m_decoded_input.substring_from_byte_offset_with_shared_superstring(offset, current_byte_offset() - offset));
 }
 
+ReadonlyBytes Tokenizer::remaining_bytes() const
+{
+    return m_decoded_input.bytes().slice(current_byte_offset());
+}
+
+// Consumes the given number of bytes, which must end on a code point boundary, exactly as if each of their code points
+// had been consumed with next_code_point(). Returns the consumed bytes.
+StringView Tokenizer::consume_bytes(size_t byte_count)
+{
+    auto start_byte_offset = current_byte_offset();
+    auto bytes = m_decoded_input.bytes().slice(start_byte_offset, byte_count);
+    if (bytes.is_empty())
+        return {};
+
+    size_t last_code_point_offset = 0;
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        // Skip UTF-8 continuation bytes.
+        if ((bytes[i] & 0xC0) == 0x80)
+            continue;
+
+        last_code_point_offset = i;
+        m_prev_position = m_position;
+        if (is_newline(bytes[i])) {
+            m_position.line++;
+            m_position.column = 0;
+        } else {
+            m_position.column++;
+        }
+    }
+
+    m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(start_byte_offset + last_code_point_offset);
+    m_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(start_byte_offset + bytes.size());
+    return StringView { bytes };
+}
+
 }
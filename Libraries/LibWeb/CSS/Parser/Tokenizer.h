@@ -62,6 +62,10 @@ class WEB_API Tokenizer {
 public:
     static Vector<Token> tokenize(StringView input, StringView encoding);
 
+    // Input that is already a UTF-8 String doesn't need to be decoded again, and is only copied if it contains code
+    // points that need filtering.
+    static Vector<Token> tokenize(String const& input);
+
     [[nodiscard]] static Token create_eof_token();
 
 private:
@@ -71,6 +75,8 @@ private:
 
     size_t current_byte_offset() const;
     String input_since(size_t offset) const;
+    ReadonlyBytes remaining_bytes() const;
+    StringView consume_bytes(size_t byte_count);
 
     [[nodiscard]] u32 next_code_point();
     [[nodiscard]] u32 peek_code_point(size_t offset = 0) const;
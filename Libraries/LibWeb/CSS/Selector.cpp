@@ -36,6 +36,10 @@ static bool component_value_contains_nesting_selector(Parser::ComponentValue con
 
 static bool can_selector_use_fast_matches(Selector const& selector)
 {
+    // Relative selectors (like the arguments of :has()) start with a combinator, which fast matching doesn't handle.
+    if (selector.compound_selectors().is_empty() || selector.compound_selectors().first().combinator != Selector::Combinator::None)
+        return false;
+
     for (auto const& compound_selector : selector.compound_selectors()) {
         if (!first_is_one_of(compound_selector.combinator,
                 Selector::Combinator::None, Selector::Combinator::Descendant, Selector::Combinator::ImmediateChild)) {
@@ -133,6 +137,8 @@ Selector::Selector(Vector<CompoundSelector>&& compound_selectors)
     collect_ancestor_hashes();
 
     m_can_use_fast_matches = can_selector_use_fast_matches(*this);
+    if (m_can_use_fast_matches)
+        compile_fast_match_program();
 }
 
 void Selector::collect_ancestor_hashes()
@@ -189,6 +195,72 @@ void Selector::collect_ancestor_hashes()
 }
 
 // https://www.w3.org/TR/selectors-4/#specificity-rules
+static Optional<Selector::FastMatchInstruction::Opcode> fast_match_opcode_for(Selector::SimpleSelector const& simple_selector)
+{
+    using Opcode = Selector::FastMatchInstruction::Opcode;
+    switch (simple_selector.type) {
+    case Selector::SimpleSelector::Type::Id:
+        return Opcode::MatchId;
+    case Selector::SimpleSelector::Type::Class:
+        return Opcode::MatchClass;
+    case Selector::SimpleSelector::Type::TagName:
+        return Opcode::MatchTagName;
+    case Selector::SimpleSelector::Type::Universal:
+        return Opcode::MatchUniversal;
+    case Selector::SimpleSelector::Type::Attribute:
+        return Opcode::MatchAttribute;
+    case Selector::SimpleSelector::Type::PseudoClass:
+        return Opcode::MatchPseudoClass;
+    default:
+        return {};
+    }
+}
+
+void Selector::compile_fast_match_program()
+{
+    using Opcode = FastMatchInstruction::Opcode;
+
+    // The Match* opcodes are declared from cheapest to most expensive to evaluate, and checks on ids, classes and
+    // tag names are also the ones most likely to reject an element, so emitting each compound selector's simple
+    // selectors grouped by opcode lets a mismatch bail out as early as possible.
+    static constexpr Array match_opcodes_in_evaluation_order {
+        Opcode::MatchId,
+        Opcode::MatchClass,
+        Opcode::MatchTagName,
+        Opcode::MatchUniversal,
+        Opcode::MatchAttribute,
+        Opcode::MatchPseudoClass,
+    };
+
+    for (ssize_t i = m_compound_selectors.size() - 1; i >= 0; --i) {
+        auto const& compound_selector = m_compound_selectors[i];
+
+        for (auto opcode : match_opcodes_in_evaluation_order) {
+            for (auto const& simple_selector : compound_selector.simple_selectors) {
+                if (fast_match_opcode_for(simple_selector) == opcode)
+                    m_fast_match_program.append({ opcode, &simple_selector });
+            }
+        }
+
+        switch (compound_selector.combinator) {
+        case Combinator::None:
+            m_fast_match_program.append({ Opcode::Accept });
+            return;
+        case Combinator::Descendant:
+            m_fast_match_program.append({ Opcode::Descendant });
+            break;
+        case Combinator::ImmediateChild:
+            m_fast_match_program.append({ Opcode::ImmediateChild });
+            break;
+        default:
+            VERIFY_NOT_REACHED();
+        }
+    }
+
+    // NOTE: The leftmost compound selector never has a combinator, so we should always have returned above.
+    VERIFY_NOT_REACHED();
+}
+
 u32 Selector::specificity() const
 {
     if (m_specificity.has_value())
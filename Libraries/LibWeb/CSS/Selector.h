@@ -204,6 +204,30 @@ public:
         Optional<CompoundSelector> absolutized(SimpleSelector const& selector_for_nesting) const;
     };
 
+    // A selector that can use fast matching is also compiled into a flat program when it is created, so that
+    // matching it is a single loop over a contiguous array instead of a walk over the nested compound and simple
+    // selectors. Each compound selector becomes a run of Match* instructions, ordered so that the cheapest and most
+    // selective checks come first, followed by the combinator leading to the next compound selector to the left.
+    // The program always ends in Accept.
+    struct FastMatchInstruction {
+        enum class Opcode : u8 {
+            MatchId,
+            MatchClass,
+            MatchTagName,
+            MatchUniversal,
+            MatchAttribute,
+            MatchPseudoClass,
+            Descendant,
+            ImmediateChild,
+            Accept,
+        };
+
+        Opcode opcode { Opcode::Accept };
+        SimpleSelector const* simple_selector { nullptr };
+
+        bool is_combinator() const { return opcode >= Opcode::Descendant; }
+    };
+
     static NonnullRefPtr<Selector> create(Vector<CompoundSelector>&& compound_selectors)
     {
         return adopt_ref(*new Selector(move(compound_selectors)));
@@ -224,6 +248,7 @@ public:
     auto const& ancestor_hashes() const { return m_ancestor_hashes; }
 
     bool can_use_fast_matches() const { return m_can_use_fast_matches; }
+    ReadonlySpan<FastMatchInstruction> fast_match_program() const { return m_fast_match_program; }
     bool can_use_ancestor_filter() const { return m_can_use_ancestor_filter; }
 
     size_t sibling_invalidation_distance() const;
@@ -244,8 +269,10 @@ private:
     PseudoClassBitmap m_contained_pseudo_classes;
 
     void collect_ancestor_hashes();
+    void compile_fast_match_program();
 
     Array<u32, 8> m_ancestor_hashes;
+    Vector<FastMatchInstruction> m_fast_match_program;
 };
 
 String serialize_a_group_of_selectors(SelectorList const& selectors);
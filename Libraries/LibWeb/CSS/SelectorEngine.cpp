@@ -1227,20 +1227,38 @@ bool matches(CSS::Selector const& selector, DOM::Element const& element, GC::Ptr
     return matches(selector, selector.compound_selectors().size() - 1, element, shadow_host, context, scope, selector_kind, anchor);
 }
 
-static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& simple_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
+bool matches_pseudo_class_without_arguments(CSS::PseudoClass pseudo_class, DOM::Element const& element)
 {
-    if (should_block_shadow_host_matching(simple_selector, shadow_host, element))
-        return false;
+    VERIFY(CSS::pseudo_class_metadata(pseudo_class).parameter_type == CSS::PseudoClassMetadata::ParameterType::None);
+    CSS::Selector::SimpleSelector::PseudoClassSelector pseudo_class_selector { .type = pseudo_class };
+    MatchContext context;
+    return matches_pseudo_class(pseudo_class_selector, element, nullptr, context, nullptr, SelectorKind::Normal);
+}
 
-    switch (simple_selector.type) {
-    case CSS::Selector::SimpleSelector::Type::Universal:
-        return matches_namespace(simple_selector.qualified_name(), element, context.style_sheet_for_rule);
-    case CSS::Selector::SimpleSelector::Type::TagName:
+// Properties of the document that every instruction would otherwise have to look up again for each element it tests.
+struct FastMatchDocumentState {
+    bool is_html_document { false };
+    CaseSensitivity class_case_sensitivity { CaseSensitivity::CaseSensitive };
+};
+
+static ALWAYS_INLINE bool fast_matches_instruction(CSS::Selector::FastMatchInstruction const& instruction, DOM::Element const& element, FastMatchDocumentState const& document_state, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
+{
+    using Opcode = CSS::Selector::FastMatchInstruction::Opcode;
+    auto const& simple_selector = *instruction.simple_selector;
+
+    switch (instruction.opcode) {
+    case Opcode::MatchId:
+        return simple_selector.name() == element.id();
+    case Opcode::MatchClass:
+        // Class selectors are matched case insensitively in quirks mode.
+        // See: https://drafts.csswg.org/selectors-4/#class-html
+        return element.has_class(simple_selector.name(), document_state.class_case_sensitivity);
+    case Opcode::MatchTagName:
         // https://html.spec.whatwg.org/multipage/semantics-other.html#case-sensitivity-of-selectors
         // When comparing a CSS element type selector to the names of HTML elements in HTML documents, the CSS element type selector must first be converted to ASCII lowercase. The
         // same selector when compared to other elements must be compared according to its original case. In both cases, to match the values must be identical to each other (and therefore
         // the comparison is case sensitive).
-        if (element.namespace_uri() == Namespace::HTML && element.document().document_type() == DOM::Document::Type::HTML) {
+        if (document_state.is_html_document && element.namespace_uri() == Namespace::HTML) {
             if (simple_selector.qualified_name().name.lowercase_name != element.local_name())
                 return false;
         } else if (simple_selector.qualified_name().name.name != element.local_name()) {
@@ -1248,27 +1266,31 @@ static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& si
             return false;
         }
         return matches_namespace(simple_selector.qualified_name(), element, context.style_sheet_for_rule);
-    case CSS::Selector::SimpleSelector::Type::Class: {
-        // Class selectors are matched case insensitively in quirks mode.
-        // See: https://drafts.csswg.org/selectors-4/#class-html
-        auto case_sensitivity = element.document().in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive;
-        return element.has_class(simple_selector.name(), case_sensitivity);
-    }
-    case CSS::Selector::SimpleSelector::Type::Id:
-        return simple_selector.name() == element.id();
-    case CSS::Selector::SimpleSelector::Type::Attribute:
+    case Opcode::MatchUniversal:
+        return matches_namespace(simple_selector.qualified_name(), element, context.style_sheet_for_rule);
+    case Opcode::MatchAttribute:
         return matches_attribute(simple_selector.attribute(), context.style_sheet_for_rule, element);
-    case CSS::Selector::SimpleSelector::Type::PseudoClass:
+    case Opcode::MatchPseudoClass:
         return matches_pseudo_class(simple_selector.pseudo_class(), element, shadow_host, context, nullptr, SelectorKind::Normal);
     default:
         VERIFY_NOT_REACHED();
     }
 }
 
-static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const& compound_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
+// Runs the instructions of one compound selector starting at `pc` against `element`. On success, `pc` is left
+// pointing at the combinator that ends the compound selector.
+static bool fast_matches_compound_selector(ReadonlySpan<CSS::Selector::FastMatchInstruction> program, size_t& pc, DOM::Element const& element, FastMatchDocumentState const& document_state, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
-    for (auto const& simple_selector : compound_selector.simple_selectors) {
-        if (!fast_matches_simple_selector(simple_selector, element, shadow_host, context))
+    if (program[pc].is_combinator())
+        return true;
+
+    // NOTE: From within a shadow tree, only :host (and selectors containing it) can match the host element,
+    //       and none of those can be fast matched.
+    if (shadow_host && &element == shadow_host.ptr())
+        return false;
+
+    for (; !program[pc].is_combinator(); ++pc) {
+        if (!fast_matches_instruction(program[pc], element, document_state, shadow_host, context))
             return false;
     }
     return true;
@@ -1276,48 +1298,53 @@ static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const
 
 bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_match, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
-    DOM::Element const* current = &element_to_match;
+    using Opcode = CSS::Selector::FastMatchInstruction::Opcode;
+
+    auto program = selector.fast_match_program();
+    auto const& document = element_to_match.document();
+    FastMatchDocumentState const document_state {
+        .is_html_document = document.document_type() == DOM::Document::Type::HTML,
+        .class_case_sensitivity = document.in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive,
+    };
 
-    ssize_t compound_selector_index = selector.compound_selectors().size() - 1;
+    DOM::Element const* current = &element_to_match;
+    size_t pc = 0;
 
-    if (!fast_matches_compound_selector(selector.compound_selectors().last(), *current, shadow_host, context))
+    if (!fast_matches_compound_selector(program, pc, *current, document_state, shadow_host, context))
         return false;
 
-    // NOTE: If we fail after following a child combinator, we may need to backtrack
-    //       to the last matched descendant. We store the state here.
+    // NOTE: If we fail after following a child combinator, we may need to backtrack to the element matched by the
+    //       last descendant combinator and keep looking for a match further up the tree. We store the state here.
     struct {
         GC::Ptr<DOM::Element const> element;
-        ssize_t compound_selector_index = 0;
+        size_t pc { 0 };
     } backtrack_state;
 
     for (;;) {
-        // NOTE: There should always be a leftmost compound selector without combinator that kicks us out of this loop.
-        VERIFY(compound_selector_index >= 0);
-
-        auto const* compound_selector = &selector.compound_selectors()[compound_selector_index];
-
-        switch (compound_selector->combinator) {
-        case CSS::Selector::Combinator::None:
+        switch (program[pc].opcode) {
+        case Opcode::Accept:
             return true;
-        case CSS::Selector::Combinator::Descendant:
-            backtrack_state = { current->parent_element(), compound_selector_index };
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+        case Opcode::Descendant: {
+            auto const descendant_pc = pc;
             for (current = current->parent_element(); current; current = current->parent_element()) {
-                if (fast_matches_compound_selector(*compound_selector, *current, shadow_host, context))
+                pc = descendant_pc + 1;
+                if (fast_matches_compound_selector(program, pc, *current, document_state, shadow_host, context))
                     break;
             }
             if (!current)
                 return false;
+            backtrack_state = { current, descendant_pc };
             break;
-        case CSS::Selector::Combinator::ImmediateChild:
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+        }
+        case Opcode::ImmediateChild:
             current = current->parent_element();
             if (!current)
                 return false;
-            if (!fast_matches_compound_selector(*compound_selector, *current, shadow_host, context)) {
+            ++pc;
+            if (!fast_matches_compound_selector(program, pc, *current, document_state, shadow_host, context)) {
                 if (backtrack_state.element) {
                     current = backtrack_state.element;
-                    compound_selector_index = backtrack_state.compound_selector_index;
+                    pc = backtrack_state.pc;
                     continue;
                 }
                 return false;
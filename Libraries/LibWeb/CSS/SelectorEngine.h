@@ -26,4 +26,7 @@ struct MatchContext {
 
 bool matches(CSS::Selector const&, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context, Optional<CSS::PseudoElement> = {}, GC::Ptr<DOM::ParentNode const> scope = {}, SelectorKind selector_kind = SelectorKind::Normal, GC::Ptr<DOM::Element const> anchor = nullptr);
 
+// Evaluates a pseudo-class that takes no arguments against the element on its own, outside of any selector.
+bool matches_pseudo_class_without_arguments(CSS::PseudoClass, DOM::Element const&);
+
 }
@@ -46,6 +46,7 @@
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/CSS/StyleProperty.h>
+#include <LibWeb/CSS/StyleRecalcTrace.h>
 #include <LibWeb/CSS/StyleSheet.h>
 #include <LibWeb/CSS/StyleValues/AngleStyleValue.h>
 #include <LibWeb/CSS/StyleValues/BorderRadiusStyleValue.h>
@@ -80,6 +81,7 @@
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/Fetch/Infrastructure/FetchController.h>
 #include <LibWeb/Fetch/Response.h>
@@ -203,16 +205,36 @@ StyleComputer::StyleComputer(DOM::Document& document)
     , m_default_font_metrics(16, Platform::FontPlugin::the().default_font(16)->pixel_metrics(), InitialValues::line_height())
     , m_root_element_font_metrics(m_default_font_metrics)
 {
-    m_ancestor_filter = make<CountingBloomFilter<u8, 14>>();
+    m_traversal_state = make<StyleTraversalState>();
+    m_traversal_state->ancestor_filter.clear();
+
+    if (style_recalc_tracing_enabled())
+        start_style_recalc_trace();
 }
 
 StyleComputer::~StyleComputer() = default;
 
+void StyleComputer::start_style_recalc_trace()
+{
+    m_style_recalc_trace = make<StyleRecalcTrace>();
+}
+
+String StyleComputer::stop_style_recalc_trace()
+{
+    if (!m_style_recalc_trace)
+        return {};
+    auto json = m_style_recalc_trace->to_json();
+    m_style_recalc_trace = nullptr;
+    return json;
+}
+
 void StyleComputer::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_document);
     visitor.visit(m_loaded_fonts);
+    for (auto* state = m_traversal_state.ptr(); state; state = state->previous.ptr())
+        visitor.visit(state->style_sharing_candidates);
 }
 
 FontLoader::FontLoader(StyleComputer& style_computer, GC::Ptr<CSSStyleSheet> parent_style_sheet, FlyString family_name, Vector<Gfx::UnicodeRange> unicode_ranges, Vector<URL> urls, Function<void(RefPtr<Gfx::Typeface const>)> on_load)
@@ -417,35 +439,11 @@ InvalidationSet StyleComputer::invalidation_set_for_properties(Vector<Invalidati
     return result;
 }
 
-bool StyleComputer::invalidation_property_used_in_has_selector(InvalidationSet::Property const& property, StyleScope const& style_scope) const
+HasInvalidationScope StyleComputer::has_invalidation_scope_for_property(InvalidationSet::Property const& property, StyleScope const& style_scope) const
 {
     if (!style_scope.m_style_invalidation_data)
-        return true;
-    switch (property.type) {
-    case InvalidationSet::Property::Type::Id:
-        if (style_scope.m_style_invalidation_data->ids_used_in_has_selectors.contains(property.name()))
-            return true;
-        break;
-    case InvalidationSet::Property::Type::Class:
-        if (style_scope.m_style_invalidation_data->class_names_used_in_has_selectors.contains(property.name()))
-            return true;
-        break;
-    case InvalidationSet::Property::Type::Attribute:
-        if (style_scope.m_style_invalidation_data->attribute_names_used_in_has_selectors.contains(property.name()))
-            return true;
-        break;
-    case InvalidationSet::Property::Type::TagName:
-        if (style_scope.m_style_invalidation_data->tag_names_used_in_has_selectors.contains(property.name()))
-            return true;
-        break;
-    case InvalidationSet::Property::Type::PseudoClass:
-        if (style_scope.m_style_invalidation_data->pseudo_classes_used_in_has_selectors.contains(property.value.get<PseudoClass>()))
-            return true;
-        break;
-    default:
-        break;
-    }
-    return false;
+        return HasInvalidationScope::All;
+    return style_scope.m_style_invalidation_data->has_invalidation_scopes.get(property).value_or(HasInvalidationScope::None);
 }
 
 Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractElement abstract_element, CascadeOrigin cascade_origin, PseudoClassBitmap& attempted_pseudo_class_matches, Optional<FlyString const> qualified_layer_name) const
@@ -484,9 +482,11 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
         if (!rule_is_relevant_for_current_scope)
             return;
 
-        auto const& selector = rule_to_run.selector;
-        if (selector.can_use_ancestor_filter() && should_reject_with_ancestor_filter(selector))
+        ++m_rule_matching_statistics.candidate_rules;
+        if (rule_to_run.can_use_ancestor_filter && should_reject_with_ancestor_filter(rule_to_run.ancestor_hashes.span())) {
+            ++m_rule_matching_statistics.rules_rejected_by_ancestor_filter;
             return;
+        }
 
         rules_to_run.unchecked_append(rule_to_run);
     };
@@ -507,8 +507,17 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
     };
 
     auto add_rules_from_cache = [&](RuleCache const& rule_cache) {
-        rule_cache.for_each_matching_rules(abstract_element, [&](auto const& matching_rules) {
+        rule_cache.for_each_matching_rules(abstract_element, [&](auto const& matching_rules, Optional<PseudoClass> pseudo_class) {
+            auto rules_to_run_before = rules_to_run.size();
             add_rules_to_run(matching_rules);
+
+            // NOTE: A pseudo-class is only recorded as attempted once one of its rules makes it past the filters above.
+            //       If none does, the element starting to match the pseudo-class can't change its style.
+            if (pseudo_class.has_value() && rules_to_run.size() > rules_to_run_before) {
+                attempted_pseudo_class_matches.set(*pseudo_class, true);
+                if (!SelectorEngine::matches_pseudo_class_without_arguments(*pseudo_class, abstract_element.element()))
+                    rules_to_run.shrink(rules_to_run_before, true);
+            }
             return IterationDecision::Continue;
         });
     };
@@ -556,23 +565,30 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
         ScopeGuard guard = [&] {
             attempted_pseudo_class_matches |= context.attempted_pseudo_class_matches;
         };
-        if (selector.is_slotted()) {
-            if (!abstract_element.element().assigned_slot_internal())
-                continue;
-            // We're collecting rules for element, which is assigned to a slot.
-            // For ::slotted() matching, slot should be used as a subject instead of element,
-            // while element itself is saved in matching context, so selector engine could
-            // switch back to it when matching inside ::slotted() argument.
-            auto const& slot = *abstract_element.element().assigned_slot_internal();
-            context.slotted_element = &abstract_element.element();
-            context.subject = &slot;
-            if (!SelectorEngine::matches(selector, slot, shadow_host_to_use, context, PseudoElement::Slotted))
-                continue;
-        } else if (!SelectorEngine::matches(selector, abstract_element.element(), shadow_host_to_use, context, abstract_element.pseudo_element()))
+        if (selector.is_slotted() && !abstract_element.element().assigned_slot_internal())
+            continue;
+        auto matched = [&] {
+            if (selector.is_slotted()) {
+                // We're collecting rules for element, which is assigned to a slot.
+                // For ::slotted() matching, slot should be used as a subject instead of element,
+                // while element itself is saved in matching context, so selector engine could
+                // switch back to it when matching inside ::slotted() argument.
+                auto const& slot = *abstract_element.element().assigned_slot_internal();
+                context.slotted_element = &abstract_element.element();
+                context.subject = &slot;
+                return SelectorEngine::matches(selector, slot, shadow_host_to_use, context, PseudoElement::Slotted);
+            }
+            return SelectorEngine::matches(selector, abstract_element.element(), shadow_host_to_use, context, abstract_element.pseudo_element());
+        }();
+        if (m_style_recalc_trace)
+            m_style_recalc_trace->did_try_selector(selector, matched);
+        if (!matched)
             continue;
         matching_rules.append(&rule_to_run);
     }
 
+    m_rule_matching_statistics.rules_tried += rules_to_run.size();
+    m_rule_matching_statistics.rules_matched += matching_rules.size();
     return matching_rules;
 }
 
@@ -1496,6 +1512,8 @@ void StyleComputer::start_needed_transitions(ComputedProperties const& previous_
 
 StyleComputer::MatchingRuleSet StyleComputer::build_matching_rule_set(DOM::AbstractElement abstract_element, PseudoClassBitmap& attempted_pseudo_class_matches, bool& did_match_any_pseudo_element_rules, ComputeStyleMode mode, StyleScope const& style_scope) const
 {
+    ++m_rule_matching_statistics.elements;
+
     // First, we collect all the CSS rules whose selectors match `element`:
     MatchingRuleSet matching_rule_set;
     matching_rule_set.user_agent_rules = collect_matching_rules(abstract_element, CascadeOrigin::UserAgent, attempted_pseudo_class_matches);
@@ -2349,21 +2367,28 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
     PseudoClassBitmap attempted_pseudo_class_matches;
-    auto matching_rule_set = build_matching_rule_set(abstract_element, attempted_pseudo_class_matches, did_match_any_pseudo_element_rules, mode, style_scope);
+    auto matching_rule_set = [&] {
+        StyleRecalcTrace::PhaseTimer timer { m_style_recalc_trace.ptr(), StyleRecalcTrace::Phase::SelectorMatching };
+        return build_matching_rule_set(abstract_element, attempted_pseudo_class_matches, did_match_any_pseudo_element_rules, mode, style_scope);
+    }();
 
     auto old_custom_properties = abstract_element.custom_properties();
 
-    // Resolve all the CSS custom properties ("variables") for this element:
-    if (!abstract_element.pseudo_element().has_value() || pseudo_element_supports_property(*abstract_element.pseudo_element(), PropertyID::Custom)) {
-        OrderedHashMap<FlyString, StyleProperty> custom_properties;
-        for (auto& layer : matching_rule_set.author_rules) {
-            cascade_custom_properties(abstract_element, layer.rules, custom_properties);
+    auto cascaded_properties = [&] {
+        StyleRecalcTrace::PhaseTimer timer { m_style_recalc_trace.ptr(), StyleRecalcTrace::Phase::Cascade };
+
+        // Resolve all the CSS custom properties ("variables") for this element:
+        if (!abstract_element.pseudo_element().has_value() || pseudo_element_supports_property(*abstract_element.pseudo_element(), PropertyID::Custom)) {
+            OrderedHashMap<FlyString, StyleProperty> custom_properties;
+            for (auto& layer : matching_rule_set.author_rules) {
+                cascade_custom_properties(abstract_element, layer.rules, custom_properties);
+            }
+            abstract_element.set_custom_properties(move(custom_properties));
         }
-        abstract_element.set_custom_properties(move(custom_properties));
-    }
 
-    auto logical_alias_mapping_context = compute_logical_alias_mapping_context(abstract_element, mode, matching_rule_set);
-    auto cascaded_properties = compute_cascaded_values(abstract_element, did_match_any_pseudo_element_rules, mode, matching_rule_set, logical_alias_mapping_context, {});
+        auto logical_alias_mapping_context = compute_logical_alias_mapping_context(abstract_element, mode, matching_rule_set);
+        return compute_cascaded_values(abstract_element, did_match_any_pseudo_element_rules, mode, matching_rule_set, logical_alias_mapping_context, {});
+    }();
     abstract_element.set_cascaded_properties(cascaded_properties);
 
     if (mode == ComputeStyleMode::CreatePseudoElementStyleIfNeeded) {
@@ -2395,7 +2420,10 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
         }
     }
 
-    auto computed_properties = compute_properties(abstract_element, cascaded_properties);
+    auto computed_properties = [&] {
+        StyleRecalcTrace::PhaseTimer timer { m_style_recalc_trace.ptr(), StyleRecalcTrace::Phase::ComputingValues };
+        return compute_properties(abstract_element, cascaded_properties);
+    }();
     computed_properties->set_attempted_pseudo_class_matches(attempted_pseudo_class_matches);
 
     if (did_change_custom_properties.has_value() && abstract_element.custom_properties() != old_custom_properties) {
@@ -2500,6 +2528,12 @@ GC::Ref<ComputedProperties> StyleComputer::compute_properties(DOM::AbstractEleme
 {
     auto computed_style = document().heap().allocate<CSS::ComputedProperties>();
 
+    // Start out sharing values with the parent and the initial values, so that any groups of properties that end up
+    // the same as those aren't copied.
+    if (auto inheritance_parent = abstract_element.element_to_inherit_style_from(); inheritance_parent.has_value() && inheritance_parent->computed_properties())
+        computed_style->share_inherited_property_values_with(*inheritance_parent->computed_properties());
+    computed_style->set_non_inherited_properties_to_initial_values();
+
     auto new_font_size = recascade_font_size_if_needed(abstract_element, cascaded_properties);
     if (new_font_size)
         computed_style->set_property(PropertyID::FontSize, *new_font_size, ComputedProperties::Inherited::No, Important::No);
@@ -3409,22 +3443,186 @@ static void for_each_element_hash(DOM::Element const& element, auto callback)
     });
 }
 
-void StyleComputer::reset_ancestor_filter()
+static bool is_eligible_for_style_sharing(DOM::Element& element)
+{
+    if (element.id().has_value() || element.inline_style() || element.is_shadow_host() || element.assigned_slot_internal())
+        return false;
+    if (element.use_pseudo_element().has_value() || element.rendered_in_top_layer() || element.has_css_defined_animations())
+        return false;
+    auto animations = element.get_animations_internal(Animations::GetAnimationsOptions { .subtree = false });
+    return !animations.is_exception() && animations.value().is_empty();
+}
+
+static bool has_same_attributes_for_style_sharing(DOM::Element const& element, DOM::Element const& other, StyleScope const& style_scope)
+{
+    // Attributes that no selector looks at can differ, as long as they can't affect style in any other way either.
+    // We only trust that for data-* attributes in the document's own scope, since those never act as presentational
+    // hints and their names are all we need to check against the rule cache.
+    bool can_ignore_unused_attributes = element.root().is_document();
+    bool attributes_match = true;
+    element.for_each_attribute([&](DOM::Attr const& attribute) {
+        if (!attributes_match)
+            return;
+        if (auto other_attributes = other.attributes()) {
+            if (auto const* other_attribute = other_attributes->get_attribute_ns(attribute.namespace_uri(), attribute.local_name()); other_attribute && other_attribute->value() == attribute.value())
+                return;
+        }
+        if (can_ignore_unused_attributes && !attribute.namespace_uri().has_value() && attribute.local_name().starts_with_bytes("data-"sv) && !style_scope.is_attribute_name_used_in_selectors(attribute.local_name()))
+            return;
+        attributes_match = false;
+    });
+    return attributes_match;
+}
+
+bool StyleComputer::can_share_style(DOM::Element& element, DOM::Element& candidate) const
+{
+    if (&element == &candidate || element.parent() != candidate.parent() || !element.parent_element())
+        return false;
+    if (candidate.needs_style_update() || !candidate.computed_properties())
+        return false;
+    if (element.local_name() != candidate.local_name() || element.namespace_uri() != candidate.namespace_uri())
+        return false;
+
+    // Anything that made the candidate's style depend on its siblings, its position or its own attribute values
+    // means we can't tell from here whether the element would end up with the same style.
+    if (candidate.affected_by_has_pseudo_class_in_subject_position()
+        || candidate.affected_by_has_pseudo_class_in_non_subject_position()
+        || candidate.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator()
+        || candidate.affected_by_direct_sibling_combinator()
+        || candidate.affected_by_indirect_sibling_combinator()
+        || candidate.affected_by_sibling_position_or_count_pseudo_class()
+        || candidate.affected_by_nth_child_pseudo_class()
+        || candidate.style_uses_attr_css_function()
+        || candidate.style_uses_tree_counting_function()) {
+        return false;
+    }
+
+    auto const& candidate_style = *candidate.computed_properties();
+    if (candidate_style.transition_property_source() || !candidate_style.animated_property_values().is_empty())
+        return false;
+    if (element.cached_transition_property_source({}) || !element.property_ids_with_existing_transitions({}).is_empty())
+        return false;
+
+    if (!is_eligible_for_style_sharing(element) || !is_eligible_for_style_sharing(candidate))
+        return false;
+
+    auto const& style_scope = DOM::AbstractElement { element }.style_scope();
+    if (!has_same_attributes_for_style_sharing(element, candidate, style_scope) || !has_same_attributes_for_style_sharing(candidate, element, style_scope))
+        return false;
+
+    // Every pseudo-class the candidate's rules looked at must give the same answer for the element.
+    for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
+        auto pseudo_class = static_cast<PseudoClass>(i);
+        if (!candidate_style.has_attempted_match_against_pseudo_class(pseudo_class))
+            continue;
+
+        switch (pseudo_class) {
+        case PseudoClass::Is:
+        case PseudoClass::Where:
+        case PseudoClass::Not:
+        case PseudoClass::Lang:
+            // These only depend on their arguments (whose own pseudo-classes are recorded separately),
+            // or on attributes we've already compared.
+            continue;
+        case PseudoClass::FirstChild:
+        case PseudoClass::LastChild:
+        case PseudoClass::OnlyChild:
+        case PseudoClass::FirstOfType:
+        case PseudoClass::LastOfType:
+        case PseudoClass::OnlyOfType:
+        case PseudoClass::Empty:
+        case PseudoClass::Root:
+        case PseudoClass::Host:
+        case PseudoClass::Scope:
+            return false;
+        default:
+            break;
+        }
+
+        if (pseudo_class_metadata(pseudo_class).parameter_type != PseudoClassMetadata::ParameterType::None)
+            return false;
+        if (SelectorEngine::matches_pseudo_class_without_arguments(pseudo_class, element) != SelectorEngine::matches_pseudo_class_without_arguments(pseudo_class, candidate))
+            return false;
+    }
+
+    return true;
+}
+
+GC::Ptr<ComputedProperties> StyleComputer::share_style_with_sibling_if_possible(DOM::Element& element, bool& did_change_custom_properties)
 {
-    m_ancestor_filter->clear();
+    for (auto& candidate : m_traversal_state->style_sharing_candidates) {
+        if (!can_share_style(element, candidate))
+            continue;
+
+        auto const& candidate_custom_properties = candidate->custom_properties({});
+        if (element.custom_properties({}) != candidate_custom_properties) {
+            element.set_custom_properties({}, candidate_custom_properties);
+            did_change_custom_properties = true;
+        }
+        element.set_cascaded_properties({}, candidate->cascaded_properties({}));
+        if (candidate->style_uses_var_css_function())
+            element.set_style_uses_var_css_function();
+        element.set_needs_style_update(false);
+        ++m_rule_matching_statistics.elements_sharing_style;
+        return candidate->computed_properties()->clone();
+    }
+    return {};
+}
+
+void StyleComputer::add_style_sharing_candidate(DOM::Element& element)
+{
+    if (!element.parent_element())
+        return;
+    auto& candidates = m_traversal_state->style_sharing_candidates;
+    if (candidates.size() == StyleTraversalState::style_sharing_cache_size)
+        candidates.take_last();
+    candidates.prepend(element);
+}
+
+StyleComputer::TraversalScope::TraversalScope(StyleComputer& style_computer, DOM::Node const& traversal_root)
+    : m_style_computer(style_computer)
+    , m_traversal_root(traversal_root)
+{
+    OwnPtr<StyleTraversalState> state;
+    if (!style_computer.m_spare_traversal_states.is_empty()) {
+        state = style_computer.m_spare_traversal_states.take_last();
+    } else {
+        state = make<StyleTraversalState>();
+        state->ancestor_filter.clear();
+    }
+    state->previous = move(style_computer.m_traversal_state);
+    style_computer.m_traversal_state = move(state);
+
+    // NOTE: The filter only ever has to over-approximate the set of ancestors, so it's fine to include
+    //       shadow hosts here even though selectors inside a shadow tree can't see past them.
+    for (auto const* ancestor = traversal_root.parent_or_shadow_host_element(); ancestor; ancestor = ancestor->parent_or_shadow_host_element())
+        m_style_computer.push_ancestor(*ancestor);
+}
+
+StyleComputer::TraversalScope::~TraversalScope()
+{
+    // NOTE: Should an ancestor have changed in the meantime, its counters may be left behind in the filter. That only
+    //       makes the filter over-approximate the ancestors of the next traversal to use it, which is harmless.
+    for (auto const* ancestor = m_traversal_root.parent_or_shadow_host_element(); ancestor; ancestor = ancestor->parent_or_shadow_host_element())
+        m_style_computer.pop_ancestor(*ancestor);
+
+    auto state = m_style_computer.m_traversal_state.release_nonnull();
+    m_style_computer.m_traversal_state = move(state->previous);
+    state->style_sharing_candidates.clear();
+    m_style_computer.m_spare_traversal_states.append(move(state));
 }
 
 void StyleComputer::push_ancestor(DOM::Element const& element)
 {
     for_each_element_hash(element, [&](u32 hash) {
-        m_ancestor_filter->increment(hash);
+        m_traversal_state->ancestor_filter.increment(hash);
     });
 }
 
 void StyleComputer::pop_ancestor(DOM::Element const& element)
 {
     for_each_element_hash(element, [&](u32 hash) {
-        m_ancestor_filter->decrement(hash);
+        m_traversal_state->ancestor_filter.decrement(hash);
     });
 }
 
@@ -3440,6 +3638,33 @@ size_t StyleComputer::number_of_css_font_faces_with_loading_in_progress() const
     return count;
 }
 
+// Pseudo-classes that only depend on the state of the element itself, so testing one against an element on its own
+// tells us whether any rule requiring it in its rightmost compound can match.
+static bool is_pseudo_class_bucketable(PseudoClass pseudo_class)
+{
+    switch (pseudo_class) {
+    case PseudoClass::Active:
+    case PseudoClass::AnyLink:
+    case PseudoClass::Checked:
+    case PseudoClass::Disabled:
+    case PseudoClass::Enabled:
+    case PseudoClass::Focus:
+    case PseudoClass::FocusVisible:
+    case PseudoClass::FocusWithin:
+    case PseudoClass::Hover:
+    case PseudoClass::Indeterminate:
+    case PseudoClass::Link:
+    case PseudoClass::LocalLink:
+    case PseudoClass::PlaceholderShown:
+    case PseudoClass::Target:
+    case PseudoClass::Unchecked:
+    case PseudoClass::Visited:
+        return true;
+    default:
+        return false;
+    }
+}
+
 void RuleCache::add_rule(MatchingRule const& matching_rule, Optional<PseudoElement> pseudo_element, bool contains_root_pseudo_class)
 {
     if (matching_rule.slotted) {
@@ -3499,37 +3724,60 @@ void RuleCache::add_rule(MatchingRule const& matching_rule, Optional<PseudoEleme
     } else if (contains_root_pseudo_class) {
         root_rules.append(matching_rule);
     } else {
-        for (auto const& simple_selector : matching_rule.selector.compound_selectors().last().simple_selectors) {
+        auto const& rightmost_simple_selectors = matching_rule.selector.compound_selectors().last().simple_selectors;
+        for (auto const& simple_selector : rightmost_simple_selectors) {
+            if (simple_selector.type == Selector::SimpleSelector::Type::Attribute && simple_selector.attribute().match_type == Selector::SimpleSelector::Attribute::MatchType::ExactValueMatch) {
+                auto const& attribute = simple_selector.attribute();
+                rules_by_attribute_value.ensure(attribute_value_bucket_hash(attribute.qualified_name.name.lowercase_name, attribute.value)).append(matching_rule);
+                return;
+            }
+        }
+        for (auto const& simple_selector : rightmost_simple_selectors) {
             if (simple_selector.type == Selector::SimpleSelector::Type::Attribute) {
                 rules_by_attribute_name.ensure(simple_selector.attribute().qualified_name.name.lowercase_name).append(matching_rule);
                 return;
             }
         }
+        if (!matching_rule.contains_pseudo_element) {
+            for (auto const& simple_selector : rightmost_simple_selectors) {
+                if (simple_selector.type == Selector::SimpleSelector::Type::PseudoClass && is_pseudo_class_bucketable(simple_selector.pseudo_class().type)) {
+                    rules_by_pseudo_class.ensure(simple_selector.pseudo_class().type).append(matching_rule);
+                    return;
+                }
+            }
+        }
         other_rules.append(matching_rule);
     }
 }
 
-void RuleCache::for_each_matching_rules(DOM::AbstractElement abstract_element, Function<IterationDecision(Vector<MatchingRule> const&)> callback) const
+u32 RuleCache::attribute_value_bucket_hash(FlyString const& attribute_name, StringView value)
+{
+    // NOTE: Both halves are case-insensitive, since attribute values may be matched case-insensitively.
+    //       Rules in a bucket are still matched against the element as usual.
+    return pair_int_hash(attribute_name.ascii_case_insensitive_hash(), case_insensitive_string_hash(value.characters_without_null_termination(), value.length()));
+}
+
+void RuleCache::for_each_matching_rules(DOM::AbstractElement abstract_element, Function<IterationDecision(Vector<MatchingRule> const&, Optional<PseudoClass>)> callback) const
 {
     for (auto const& class_name : abstract_element.element().class_names()) {
         if (auto it = rules_by_class.find(class_name); it != rules_by_class.end()) {
-            if (callback(it->value) == IterationDecision::Break)
+            if (callback(it->value, {}) == IterationDecision::Break)
                 return;
         }
     }
     if (auto id = abstract_element.element().id(); id.has_value()) {
         if (auto it = rules_by_id.find(id.value()); it != rules_by_id.end()) {
-            if (callback(it->value) == IterationDecision::Break)
+            if (callback(it->value, {}) == IterationDecision::Break)
                 return;
         }
     }
     if (auto it = rules_by_tag_name.find(abstract_element.element().lowercased_local_name()); it != rules_by_tag_name.end()) {
-        if (callback(it->value) == IterationDecision::Break)
+        if (callback(it->value, {}) == IterationDecision::Break)
             return;
     }
     if (abstract_element.pseudo_element().has_value()) {
         if (Selector::PseudoElementSelector::is_known_pseudo_element_type(abstract_element.pseudo_element().value())) {
-            if (callback(rules_by_pseudo_element.at(to_underlying(abstract_element.pseudo_element().value()))) == IterationDecision::Break)
+            if (callback(rules_by_pseudo_element.at(to_underlying(abstract_element.pseudo_element().value())), {}) == IterationDecision::Break)
                 return;
         } else {
             // NOTE: We don't cache rules for unknown pseudo-elements. They can't match anything anyway.
@@ -3537,20 +3785,32 @@ void RuleCache::for_each_matching_rules(DOM::AbstractElement abstract_element, F
     }
 
     if (abstract_element.element().is_document_element()) {
-        if (callback(root_rules) == IterationDecision::Break)
+        if (callback(root_rules, {}) == IterationDecision::Break)
             return;
     }
 
     IterationDecision decision = IterationDecision::Continue;
-    abstract_element.element().for_each_attribute([&](auto& name, auto&) {
+    abstract_element.element().for_each_attribute([&](auto& name, auto& value) {
         if (auto it = rules_by_attribute_name.find(name); it != rules_by_attribute_name.end()) {
-            decision = callback(it->value);
+            decision = callback(it->value, {});
+        }
+        if (!rules_by_attribute_value.is_empty()) {
+            if (auto it = rules_by_attribute_value.find(attribute_value_bucket_hash(name, value)); it != rules_by_attribute_value.end())
+                decision = callback(it->value, {});
         }
     });
     if (decision == IterationDecision::Break)
         return;
 
-    (void)callback(other_rules);
+    // NOTE: Rules in these buckets never contain a pseudo-element, so they can't match one.
+    if (!abstract_element.pseudo_element().has_value()) {
+        for (auto const& [pseudo_class, rules] : rules_by_pseudo_class) {
+            if (callback(rules, pseudo_class) == IterationDecision::Break)
+                return;
+        }
+    }
+
+    (void)callback(other_rules, {});
 }
 
 }
@@ -76,6 +76,33 @@ private:
     CounterType m_buckets[bucket_count];
 };
 
+// State that StyleComputer keeps while a single traversal walks the DOM, computing or invalidating style.
+// Traversals of independent subtrees each get their own, so that none of them sees another's ancestors or
+// style sharing candidates.
+struct StyleTraversalState {
+    static constexpr size_t style_sharing_cache_size = 16;
+
+    CountingBloomFilter<u8, 14> ancestor_filter;
+    Vector<GC::Ref<DOM::Element>, style_sharing_cache_size> style_sharing_candidates;
+
+    // The state of the traversal this one interrupted, restored once this one is done.
+    OwnPtr<StyleTraversalState> previous;
+};
+
+// Running totals of the work done to find the rules that match each element, for judging how well the rule cache
+// narrows down the rules that have to be tried.
+struct RuleMatchingStatistics {
+    u64 elements { 0 };
+    // Rules taken from the rule cache buckets that apply to an element's style scope.
+    u64 candidate_rules { 0 };
+    u64 rules_rejected_by_ancestor_filter { 0 };
+    // Rules whose selector was actually matched against an element.
+    u64 rules_tried { 0 };
+    u64 rules_matched { 0 };
+    // Elements that took their style from a sibling instead of running the cascade.
+    u64 elements_sharing_style { 0 };
+};
+
 struct FontFaceKey;
 
 struct OwnFontFaceKey {
@@ -120,19 +147,42 @@ public:
     DOM::Document& document() { return m_document; }
     DOM::Document const& document() const { return m_document; }
 
-    void reset_ancestor_filter();
+    // Gives a traversal starting at the given node its own StyleTraversalState, with the ancestor filter already
+    // holding the node's ancestors. The previous state is restored when the scope ends.
+    class TraversalScope {
+    public:
+        TraversalScope(StyleComputer&, DOM::Node const& traversal_root);
+        ~TraversalScope();
+
+    private:
+        StyleComputer& m_style_computer;
+        DOM::Node const& m_traversal_root;
+    };
+
     void push_ancestor(DOM::Element const&);
     void pop_ancestor(DOM::Element const&);
 
     [[nodiscard]] GC::Ref<ComputedProperties> create_document_style() const;
 
     [[nodiscard]] GC::Ref<ComputedProperties> compute_style(DOM::AbstractElement, Optional<bool&> did_change_custom_properties = {}) const;
+
+    // Style sharing: siblings that are indistinguishable to the selectors in play end up with identical style,
+    // so an element can take a copy of a recently styled sibling's style instead of running the cascade again.
+    [[nodiscard]] GC::Ptr<ComputedProperties> share_style_with_sibling_if_possible(DOM::Element&, bool& did_change_custom_properties);
+    void add_style_sharing_candidate(DOM::Element&);
     [[nodiscard]] GC::Ptr<ComputedProperties> compute_pseudo_element_style_if_needed(DOM::AbstractElement, Optional<bool&> did_change_custom_properties) const;
 
+    [[nodiscard]] RuleMatchingStatistics const& rule_matching_statistics() const { return m_rule_matching_statistics; }
+
+    // Opt-in tracing of what each style update does and why, see StyleRecalcTrace.
+    void start_style_recalc_trace();
+    [[nodiscard]] String stop_style_recalc_trace();
+    [[nodiscard]] StyleRecalcTrace* style_recalc_trace() const { return m_style_recalc_trace.ptr(); }
+
     [[nodiscard]] Vector<MatchingRule const*> collect_matching_rules(DOM::AbstractElement, CascadeOrigin, PseudoClassBitmap& attempted_pseudo_class_matches, Optional<FlyString const> qualified_layer_name = {}) const;
 
     InvalidationSet invalidation_set_for_properties(Vector<InvalidationSet::Property> const&, StyleScope const&) const;
-    bool invalidation_property_used_in_has_selector(InvalidationSet::Property const&, StyleScope const&) const;
+    HasInvalidationScope has_invalidation_scope_for_property(InvalidationSet::Property const&, StyleScope const&) const;
 
     Gfx::Font const& initial_font() const;
 
@@ -162,6 +212,7 @@ public:
     void process_animation_definitions(ComputedProperties const& computed_properties, DOM::AbstractElement& abstract_element) const;
 
     [[nodiscard]] inline bool should_reject_with_ancestor_filter(Selector const&) const;
+    [[nodiscard]] inline bool should_reject_with_ancestor_filter(ReadonlySpan<u32> ancestor_hashes) const;
 
     static NonnullRefPtr<StyleValue const> compute_value_of_custom_property(DOM::AbstractElement, FlyString const& custom_property, Optional<Parser::GuardedSubstitutionContexts&> = {});
 
@@ -213,6 +264,7 @@ private:
     void start_needed_transitions(ComputedProperties const& old_style, ComputedProperties& new_style, DOM::AbstractElement) const;
     void resolve_effective_overflow_values(ComputedProperties&) const;
     void transform_box_type_if_needed(ComputedProperties&, DOM::AbstractElement) const;
+    [[nodiscard]] bool can_share_style(DOM::Element&, DOM::Element& candidate) const;
 
     [[nodiscard]] CSSPixelRect viewport_rect() const { return m_viewport_rect; }
 
@@ -240,9 +292,16 @@ private:
 
     CSSPixelRect m_viewport_rect;
 
-    OwnPtr<CountingBloomFilter<u8, 14>> m_ancestor_filter;
+    OwnPtr<StyleTraversalState> m_traversal_state;
+
+    // States of finished traversals, kept around so that starting a traversal doesn't allocate and clear another
+    // ancestor filter. Their filters are left empty, since every ancestor a traversal pushes is popped again.
+    Vector<NonnullOwnPtr<StyleTraversalState>> m_spare_traversal_states;
 
     mutable HashMap<FontMatchingAlgorithmCacheKey, RefPtr<Gfx::FontCascadeList const>> m_font_matching_algorithm_cache;
+
+    mutable RuleMatchingStatistics m_rule_matching_statistics;
+    OwnPtr<StyleRecalcTrace> m_style_recalc_trace;
 };
 
 class FontLoader final : public GC::Cell {
@@ -281,10 +340,15 @@ private:
 
 inline bool StyleComputer::should_reject_with_ancestor_filter(Selector const& selector) const
 {
-    for (u32 hash : selector.ancestor_hashes()) {
+    return should_reject_with_ancestor_filter(selector.ancestor_hashes().span());
+}
+
+inline bool StyleComputer::should_reject_with_ancestor_filter(ReadonlySpan<u32> ancestor_hashes) const
+{
+    for (u32 hash : ancestor_hashes) {
         if (hash == 0)
             break;
-        if (!m_ancestor_filter->may_contain(hash))
+        if (!m_traversal_state->ancestor_filter.may_contain(hash))
             return true;
     }
     return false;
@@ -44,6 +44,7 @@ RequiredInvalidationAfterStyleChange compute_property_invalidation(CSS::Property
 
     if (AK::first_is_one_of(property_id, CSS::PropertyID::CounterReset, CSS::PropertyID::CounterSet, CSS::PropertyID::CounterIncrement)) {
         invalidation.rebuild_layout_tree = property_value_changed;
+        invalidation.rebuild_layout_tree_from_parent = property_value_changed;
         return invalidation;
     }
 
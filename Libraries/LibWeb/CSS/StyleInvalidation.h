@@ -15,6 +15,8 @@ struct RequiredInvalidationAfterStyleChange {
     bool rebuild_stacking_context_tree : 1 { false };
     bool relayout : 1 { false };
     bool rebuild_layout_tree : 1 { false };
+    // The change affects the boxes of following elements too, so the layout tree has to be rebuilt from the parent.
+    bool rebuild_layout_tree_from_parent : 1 { false };
 
     void operator|=(RequiredInvalidationAfterStyleChange const& other)
     {
@@ -22,6 +24,7 @@ struct RequiredInvalidationAfterStyleChange {
         rebuild_stacking_context_tree |= other.rebuild_stacking_context_tree;
         relayout |= other.relayout;
         rebuild_layout_tree |= other.rebuild_layout_tree;
+        rebuild_layout_tree_from_parent |= other.rebuild_layout_tree_from_parent;
     }
 
     [[nodiscard]] bool is_none() const { return !repaint && !rebuild_stacking_context_tree && !relayout && !rebuild_layout_tree; }
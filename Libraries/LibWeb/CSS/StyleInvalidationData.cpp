@@ -41,29 +41,25 @@ static void for_each_consecutive_simple_selector_group(Selector const& selector,
     }
 }
 
-static void collect_properties_used_in_has(Selector::SimpleSelector const& selector, StyleInvalidationData& style_invalidation_data, bool in_has)
+static void collect_has_invalidation_scopes_for_simple_selector(Selector::SimpleSelector const& selector, HasInvalidationScope scope, StyleInvalidationData& style_invalidation_data)
 {
+    auto add_scope = [&](InvalidationSet::Property const& property) {
+        style_invalidation_data.has_invalidation_scopes.ensure(property, [] { return HasInvalidationScope::None; }) |= scope;
+    };
+
     switch (selector.type) {
-    case Selector::SimpleSelector::Type::Id: {
-        if (in_has)
-            style_invalidation_data.ids_used_in_has_selectors.set(selector.name());
+    case Selector::SimpleSelector::Type::Id:
+        add_scope({ InvalidationSet::Property::Type::Id, selector.name() });
         break;
-    }
-    case Selector::SimpleSelector::Type::Class: {
-        if (in_has)
-            style_invalidation_data.class_names_used_in_has_selectors.set(selector.name());
+    case Selector::SimpleSelector::Type::Class:
+        add_scope({ InvalidationSet::Property::Type::Class, selector.name() });
         break;
-    }
-    case Selector::SimpleSelector::Type::Attribute: {
-        if (in_has)
-            style_invalidation_data.attribute_names_used_in_has_selectors.set(selector.attribute().qualified_name.name.lowercase_name);
+    case Selector::SimpleSelector::Type::Attribute:
+        add_scope({ InvalidationSet::Property::Type::Attribute, selector.attribute().qualified_name.name.lowercase_name });
         break;
-    }
-    case Selector::SimpleSelector::Type::TagName: {
-        if (in_has)
-            style_invalidation_data.tag_names_used_in_has_selectors.set(selector.qualified_name().name.lowercase_name);
+    case Selector::SimpleSelector::Type::TagName:
+        add_scope({ InvalidationSet::Property::Type::TagName, selector.qualified_name().name.lowercase_name });
         break;
-    }
     case Selector::SimpleSelector::Type::PseudoClass: {
         auto const& pseudo_class = selector.pseudo_class();
         switch (pseudo_class.type) {
@@ -76,17 +72,17 @@ static void collect_properties_used_in_has(Selector::SimpleSelector const& selec
         case PseudoClass::AnyLink:
         case PseudoClass::LocalLink:
         case PseudoClass::Default:
-            if (in_has)
-                style_invalidation_data.pseudo_classes_used_in_has_selectors.set(pseudo_class.type);
+            add_scope({ InvalidationSet::Property::Type::PseudoClass, pseudo_class.type });
             break;
         default:
             break;
         }
+        // Elements matched by a complex selector nested in a pseudo-class, like ".b" in ":has(:is(.b .c))",
+        // can be related to the anchor in any way, so we don't try to narrow down where the anchor is.
         for (auto const& child_selector : pseudo_class.argument_selector_list) {
             for (auto const& compound_selector : child_selector->compound_selectors()) {
-                for (auto const& simple_selector : compound_selector.simple_selectors) {
-                    collect_properties_used_in_has(simple_selector, style_invalidation_data, in_has || pseudo_class.type == PseudoClass::Has);
-                }
+                for (auto const& simple_selector : compound_selector.simple_selectors)
+                    collect_has_invalidation_scopes_for_simple_selector(simple_selector, HasInvalidationScope::All, style_invalidation_data);
             }
         }
         break;
@@ -96,6 +92,59 @@ static void collect_properties_used_in_has(Selector::SimpleSelector const& selec
     }
 }
 
+static void collect_has_invalidation_scopes(Selector::SimpleSelector const& selector, StyleInvalidationData& style_invalidation_data)
+{
+    if (selector.type != Selector::SimpleSelector::Type::PseudoClass)
+        return;
+
+    auto const& pseudo_class = selector.pseudo_class();
+    if (pseudo_class.type != PseudoClass::Has) {
+        for (auto const& child_selector : pseudo_class.argument_selector_list) {
+            for (auto const& compound_selector : child_selector->compound_selectors()) {
+                for (auto const& simple_selector : compound_selector.simple_selectors)
+                    collect_has_invalidation_scopes(simple_selector, style_invalidation_data);
+            }
+        }
+        return;
+    }
+
+    for (auto const& relative_selector : pseudo_class.argument_selector_list) {
+        auto const& compound_selectors = relative_selector->compound_selectors();
+        bool seen_descendant_combinator = false;
+        bool seen_sibling_combinator = false;
+        for (size_t i = 0; i < compound_selectors.size(); ++i) {
+            auto const& compound_selector = compound_selectors[i];
+            switch (compound_selector.combinator) {
+            case Selector::Combinator::Descendant:
+            case Selector::Combinator::ImmediateChild:
+                seen_descendant_combinator = true;
+                break;
+            case Selector::Combinator::NextSibling:
+            case Selector::Combinator::SubsequentSibling:
+                seen_sibling_combinator = true;
+                break;
+            default:
+                seen_descendant_combinator = true;
+                seen_sibling_combinator = true;
+                break;
+            }
+
+            // Only the combinators between the anchor and a compound selector decide how the elements it
+            // matches are related to the anchor. For example, in ":has(> .a .b)" the anchor of a ".a" element
+            // is its parent, while the anchor of a ".b" element can be any of its ancestors.
+            auto scope = HasInvalidationScope::All;
+            if (!seen_descendant_combinator)
+                scope = HasInvalidationScope::Siblings;
+            else if (!seen_sibling_combinator)
+                scope = i == 0 && compound_selector.combinator == Selector::Combinator::ImmediateChild ? HasInvalidationScope::Parent : HasInvalidationScope::Ancestors;
+
+            style_invalidation_data.combined_has_invalidation_scope |= scope;
+            for (auto const& simple_selector : compound_selector.simple_selectors)
+                collect_has_invalidation_scopes_for_simple_selector(simple_selector, scope, style_invalidation_data);
+        }
+    }
+}
+
 enum class ExcludePropertiesNestedInNotPseudoClass : bool {
     No,
     Yes,
@@ -218,17 +267,10 @@ static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidati
     InvalidationSet invalidation_set_for_rightmost_selector;
     Selector::Combinator previous_compound_combinator = Selector::Combinator::None;
     for_each_consecutive_simple_selector_group(selector, [&](Vector<Selector::SimpleSelector const&> const& simple_selectors, Selector::Combinator combinator, bool is_rightmost) {
-        // Collect properties used in :has() so we can decide if only specific properties
-        // trigger descendant invalidation or if the entire document must be invalidated.
-        for (auto const& simple_selector : simple_selectors) {
-            bool in_has = false;
-            if (simple_selector.type == Selector::SimpleSelector::Type::PseudoClass) {
-                auto const& pseudo_class = simple_selector.pseudo_class();
-                if (pseudo_class.type == PseudoClass::Has)
-                    in_has = true;
-            }
-            collect_properties_used_in_has(simple_selector, style_invalidation_data, in_has);
-        }
+        // Collect properties used in :has() along with where their anchors can be, so that a change to one
+        // of them only invalidates the elements around the mutated element that could be affected.
+        for (auto const& simple_selector : simple_selectors)
+            collect_has_invalidation_scopes(simple_selector, style_invalidation_data);
 
         if (is_rightmost) {
             // The rightmost selector is handled twice:
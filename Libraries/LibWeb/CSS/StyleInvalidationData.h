@@ -6,19 +6,40 @@
 
 #pragma once
 
+#include <AK/EnumBits.h>
 #include <AK/HashMap.h>
 #include <LibWeb/CSS/InvalidationSet.h>
 #include <LibWeb/Forward.h>
 
 namespace Web::CSS {
 
+// Describes where, relative to a mutated element, the anchors of :has() pseudo-classes whose match result
+// may depend on that element can be found.
+enum class HasInvalidationScope : u8 {
+    None = 0,
+    // The anchor is the parent, as in ".a:has(> .b)".
+    Parent = 1 << 0,
+    // The anchor is any ancestor, as in ".a:has(.b)" or ".a:has(> .c > .b)".
+    Ancestors = 1 << 1,
+    // The anchor is a sibling, as in ".a:has(~ .b)".
+    Siblings = 1 << 2,
+    // The anchor is a sibling of any ancestor, as in ".a:has(~ .c .b)".
+    AncestorSiblings = 1 << 3,
+    All = Parent | Ancestors | Siblings | AncestorSiblings,
+};
+
+AK_ENUM_BITWISE_OPERATORS(HasInvalidationScope);
+
 struct StyleInvalidationData {
     HashMap<InvalidationSet::Property, InvalidationSet> descendant_invalidation_sets;
-    HashTable<FlyString> ids_used_in_has_selectors;
-    HashTable<FlyString> class_names_used_in_has_selectors;
-    HashTable<FlyString> attribute_names_used_in_has_selectors;
-    HashTable<FlyString> tag_names_used_in_has_selectors;
-    HashTable<PseudoClass> pseudo_classes_used_in_has_selectors;
+
+    // Maps each property used inside a :has() argument to the elements that have to be checked for
+    // a :has() anchor when that property changes on an element.
+    HashMap<InvalidationSet::Property, HasInvalidationScope> has_invalidation_scopes;
+
+    // Union of the scopes of every compound selector inside a :has() argument. Used when an element is
+    // inserted or removed, since any of the properties of its subtree may be involved.
+    HasInvalidationScope combined_has_invalidation_scope { HasInvalidationScope::None };
 
     void build_invalidation_sets_for_selector(Selector const& selector);
 };
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/QuickSort.h>
+#include <LibWeb/CSS/Selector.h>
+#include <LibWeb/CSS/StyleRecalcTrace.h>
+#include <LibWeb/DOM/Node.h>
+
+namespace Web::CSS {
+
+static bool g_enable_style_recalc_tracing = false;
+
+void set_enable_style_recalc_tracing(bool enabled)
+{
+    g_enable_style_recalc_tracing = enabled;
+}
+
+bool style_recalc_tracing_enabled()
+{
+    return g_enable_style_recalc_tracing;
+}
+
+void StyleRecalcTrace::did_invalidate_style(DOM::Node const& node, DOM::StyleInvalidationReason reason, ReadonlySpan<InvalidationSet::Property> properties)
+{
+    if (m_current_style_update.invalidations.size() >= max_invalidations_per_style_update) {
+        ++m_current_style_update.dropped_invalidations;
+        return;
+    }
+
+    Invalidation invalidation {
+        .reason = DOM::to_string(reason),
+        .node = node.debug_description(),
+        .properties = {},
+    };
+    invalidation.properties.ensure_capacity(properties.size());
+    for (auto const& property : properties)
+        invalidation.properties.unchecked_append(MUST(String::formatted("{}", property)));
+    m_current_style_update.invalidations.append(move(invalidation));
+}
+
+void StyleRecalcTrace::begin_style_update(RuleMatchingStatistics const& rule_matching, bool is_full_style_update)
+{
+    // A nested style update is attributed to the one that triggered it.
+    if (m_style_update_nesting_depth++ > 0)
+        return;
+    m_current_style_update.is_full_style_update = is_full_style_update;
+    m_rule_matching_at_start = rule_matching;
+    m_style_update_start = MonotonicTime::now();
+}
+
+void StyleRecalcTrace::end_style_update(RuleMatchingStatistics const& rule_matching)
+{
+    VERIFY(m_style_update_nesting_depth > 0);
+    if (--m_style_update_nesting_depth > 0)
+        return;
+
+    auto& update = m_current_style_update;
+    update.total_time = MonotonicTime::now() - *m_style_update_start;
+    update.rule_matching = {
+        .elements = rule_matching.elements - m_rule_matching_at_start.elements,
+        .candidate_rules = rule_matching.candidate_rules - m_rule_matching_at_start.candidate_rules,
+        .rules_rejected_by_ancestor_filter = rule_matching.rules_rejected_by_ancestor_filter - m_rule_matching_at_start.rules_rejected_by_ancestor_filter,
+        .rules_tried = rule_matching.rules_tried - m_rule_matching_at_start.rules_tried,
+        .rules_matched = rule_matching.rules_matched - m_rule_matching_at_start.rules_matched,
+        .elements_sharing_style = rule_matching.elements_sharing_style - m_rule_matching_at_start.elements_sharing_style,
+    };
+
+    // Selectors are serialized once per update rather than on every match attempt, and the most frequently tried
+    // ones are listed first since that's where the time goes.
+    update.selectors.ensure_capacity(m_selector_costs.size());
+    for (auto const& [selector, cost] : m_selector_costs)
+        update.selectors.unchecked_append({ selector->serialize(), cost });
+    quick_sort(update.selectors, [](auto const& a, auto const& b) {
+        if (a.cost.tried != b.cost.tried)
+            return a.cost.tried > b.cost.tried;
+        return a.selector < b.selector;
+    });
+    m_selector_costs.clear();
+
+    if (m_style_updates.size() == m_style_updates.capacity())
+        ++m_dropped_style_updates;
+    m_style_updates.enqueue(move(update));
+    update = {};
+}
+
+void StyleRecalcTrace::did_try_selector(Selector const& selector, bool matched)
+{
+    auto& cost = m_selector_costs.ensure(selector);
+    ++cost.tried;
+    if (matched)
+        ++cost.matched;
+}
+
+void StyleRecalcTrace::add_time_spent_in_phase(Phase phase, AK::Duration duration)
+{
+    m_current_style_update.time_spent_in_phase[to_underlying(phase)] += duration;
+}
+
+static StringView phase_time_key(StyleRecalcTrace::Phase phase)
+{
+    switch (phase) {
+    case StyleRecalcTrace::Phase::SelectorMatching:
+        return "selectorMatchingMicroseconds"sv;
+    case StyleRecalcTrace::Phase::Cascade:
+        return "cascadeMicroseconds"sv;
+    case StyleRecalcTrace::Phase::ComputingValues:
+        return "computingValuesMicroseconds"sv;
+    case StyleRecalcTrace::Phase::__Count:
+        break;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+String StyleRecalcTrace::to_json() const
+{
+    JsonArray updates;
+    for (auto const& update : m_style_updates) {
+        JsonArray invalidations;
+        for (auto const& invalidation : update.invalidations) {
+            JsonObject object;
+            object.set("reason"sv, invalidation.reason);
+            object.set("node"sv, invalidation.node);
+            if (!invalidation.properties.is_empty()) {
+                JsonArray properties;
+                for (auto const& property : invalidation.properties)
+                    properties.must_append(property);
+                object.set("properties"sv, move(properties));
+            }
+            invalidations.must_append(move(object));
+        }
+
+        JsonArray selectors;
+        for (auto const& entry : update.selectors) {
+            JsonObject object;
+            object.set("selector"sv, entry.selector);
+            object.set("tried"sv, entry.cost.tried);
+            object.set("matched"sv, entry.cost.matched);
+            selectors.must_append(move(object));
+        }
+
+        JsonObject object;
+        object.set("invalidations"sv, move(invalidations));
+        object.set("droppedInvalidations"sv, update.dropped_invalidations);
+        object.set("fullStyleUpdate"sv, update.is_full_style_update);
+        object.set("elementsStyled"sv, update.rule_matching.elements);
+        object.set("candidateRules"sv, update.rule_matching.candidate_rules);
+        object.set("rulesRejectedByAncestorFilter"sv, update.rule_matching.rules_rejected_by_ancestor_filter);
+        object.set("rulesTried"sv, update.rule_matching.rules_tried);
+        object.set("rulesMatched"sv, update.rule_matching.rules_matched);
+        object.set("elementsSharingStyle"sv, update.rule_matching.elements_sharing_style);
+        object.set("totalMicroseconds"sv, update.total_time.to_microseconds());
+        for (size_t i = 0; i < phase_count; ++i)
+            object.set(phase_time_key(static_cast<Phase>(i)), update.time_spent_in_phase[i].to_microseconds());
+        object.set("selectors"sv, move(selectors));
+        updates.must_append(move(object));
+    }
+
+    JsonObject trace;
+    trace.set("styleUpdates"sv, move(updates));
+    trace.set("droppedStyleUpdates"sv, m_dropped_style_updates);
+    return trace.serialized();
+}
+
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/CircularQueue.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibWeb/CSS/InvalidationSet.h>
+#include <LibWeb/CSS/StyleComputer.h>
+#include <LibWeb/Export.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::DOM {
+
+enum class StyleInvalidationReason;
+
+}
+
+namespace Web::CSS {
+
+// An opt-in record of what each style update did and why, for diagnosing slow style recalcs.
+// Invalidations are collected as they happen and attributed to the next style update, which additionally records
+// how many elements it restyled, how often each selector was tried and matched, and how long was spent matching
+// selectors, running the cascade and computing values.
+class WEB_API StyleRecalcTrace {
+    AK_MAKE_NONCOPYABLE(StyleRecalcTrace);
+    AK_MAKE_NONMOVABLE(StyleRecalcTrace);
+
+public:
+    enum class Phase : u8 {
+        SelectorMatching,
+        Cascade,
+        ComputingValues,
+        __Count,
+    };
+
+    // Adds the time between construction and destruction to the given phase, if there is a trace.
+    class PhaseTimer {
+        AK_MAKE_NONCOPYABLE(PhaseTimer);
+        AK_MAKE_NONMOVABLE(PhaseTimer);
+
+    public:
+        PhaseTimer(StyleRecalcTrace* trace, Phase phase)
+            : m_trace(trace)
+            , m_phase(phase)
+        {
+            if (m_trace)
+                m_start = MonotonicTime::now();
+        }
+
+        ~PhaseTimer()
+        {
+            if (m_trace)
+                m_trace->add_time_spent_in_phase(m_phase, MonotonicTime::now() - *m_start);
+        }
+
+    private:
+        StyleRecalcTrace* m_trace { nullptr };
+        Phase m_phase;
+        Optional<MonotonicTime> m_start;
+    };
+
+    StyleRecalcTrace() = default;
+
+    void did_invalidate_style(DOM::Node const&, DOM::StyleInvalidationReason, ReadonlySpan<InvalidationSet::Property> properties = {});
+
+    void begin_style_update(RuleMatchingStatistics const&, bool is_full_style_update);
+    void end_style_update(RuleMatchingStatistics const&);
+
+    void did_try_selector(Selector const&, bool matched);
+    void add_time_spent_in_phase(Phase, AK::Duration);
+
+    [[nodiscard]] String to_json() const;
+
+private:
+    // Bounds the memory used by mutation-heavy and long-lived pages; anything beyond these is only counted.
+    static constexpr size_t max_invalidations_per_style_update = 1000;
+    static constexpr size_t max_style_updates = 100;
+    static constexpr size_t phase_count = to_underlying(Phase::__Count);
+
+    struct Invalidation {
+        StringView reason;
+        String node;
+        Vector<String> properties;
+    };
+
+    struct SelectorCost {
+        u64 tried { 0 };
+        u64 matched { 0 };
+    };
+
+    struct SelectorCostEntry {
+        String selector;
+        SelectorCost cost;
+    };
+
+    struct StyleUpdate {
+        Vector<Invalidation> invalidations;
+        size_t dropped_invalidations { 0 };
+        bool is_full_style_update { false };
+        RuleMatchingStatistics rule_matching;
+        AK::Duration total_time;
+        Array<AK::Duration, phase_count> time_spent_in_phase {};
+        Vector<SelectorCostEntry> selectors;
+    };
+
+    // The most recent style updates, oldest first.
+    CircularQueue<StyleUpdate, max_style_updates> m_style_updates;
+    size_t m_dropped_style_updates { 0 };
+
+    // State of the style update in progress, and the invalidations that will be attributed to the next one.
+    StyleUpdate m_current_style_update;
+    size_t m_style_update_nesting_depth { 0 };
+    Optional<MonotonicTime> m_style_update_start;
+    RuleMatchingStatistics m_rule_matching_at_start;
+    HashMap<NonnullRefPtr<Selector const>, SelectorCost> m_selector_costs;
+};
+
+WEB_API void set_enable_style_recalc_tracing(bool enabled);
+bool style_recalc_tracing_enabled();
+
+}
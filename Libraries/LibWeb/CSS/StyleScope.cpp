@@ -192,6 +192,8 @@ void StyleScope::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin
                     cascade_origin,
                     false,
                 };
+                matching_rule.can_use_ancestor_filter = selector.can_use_ancestor_filter();
+                matching_rule.ancestor_hashes = selector.ancestor_hashes();
 
                 auto const& qualified_layer_name = matching_rule.qualified_layer_name();
                 auto& rule_cache = qualified_layer_name.is_empty() ? rule_caches.main : *rule_caches.by_layer.ensure(qualified_layer_name, [] { return make<RuleCache>(); });
@@ -277,6 +279,8 @@ void StyleScope::collect_selector_insights(Selector const& selector, SelectorIns
 {
     for (auto const& compound_selector : selector.compound_selectors()) {
         for (auto const& simple_selector : compound_selector.simple_selectors) {
+            if (simple_selector.type == Selector::SimpleSelector::Type::Attribute)
+                insights.attribute_names.set(simple_selector.attribute().qualified_name.name.lowercase_name);
             if (simple_selector.type == Selector::SimpleSelector::Type::PseudoClass) {
                 if (simple_selector.pseudo_class().type == PseudoClass::Has) {
                     insights.has_has_selectors = true;
@@ -376,6 +380,12 @@ bool StyleScope::have_has_selectors() const
     return m_selector_insights->has_has_selectors;
 }
 
+bool StyleScope::is_attribute_name_used_in_selectors(FlyString const& attribute_name) const
+{
+    build_rule_cache_if_needed();
+    return m_selector_insights->attribute_names.contains(attribute_name);
+}
+
 DOM::Document& StyleScope::document() const
 {
     return m_node->document();
@@ -396,6 +406,20 @@ void StyleScope::for_each_active_css_style_sheet(Function<void(CSS::CSSStyleShee
     }
 }
 
+void StyleScope::schedule_ancestors_style_invalidation_due_to_presence_of_has(DOM::Node& node, HasInvalidationScope scope)
+{
+    if (scope == HasInvalidationScope::None)
+        return;
+    m_pending_nodes_for_style_invalidation_due_to_presence_of_has.ensure(node, [] { return HasInvalidationScope::None; }) |= scope;
+}
+
+HasInvalidationScope StyleScope::has_invalidation_scope_for_structural_changes() const
+{
+    if (!m_style_invalidation_data)
+        return HasInvalidationScope::All;
+    return m_style_invalidation_data->combined_has_invalidation_scope;
+}
+
 void StyleScope::invalidate_style_of_elements_affected_by_has()
 {
     if (m_pending_nodes_for_style_invalidation_due_to_presence_of_has.is_empty()) {
@@ -413,29 +437,60 @@ void StyleScope::invalidate_style_of_elements_affected_by_has()
         return;
     }
 
+    // If any sibling was tested against selectors like ".a:has(+ .b)" or ".a:has(~ .b)"
+    // its style might be affected by the change in the node.
+    auto invalidate_siblings = [](DOM::Node& node) {
+        auto* parent = node.parent_or_shadow_host();
+        if (!parent)
+            return;
+        parent->for_each_child_of_type<DOM::Element>([&](auto& sibling_element) {
+            if (sibling_element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+                sibling_element.invalidate_style_if_affected_by_has();
+            return IterationDecision::Continue;
+        });
+    };
+
+    // Many pending nodes usually share most of their ancestors. The walk above an ancestor we've already
+    // been through is the same for every node, so we stop there instead of repeating it.
+    HashTable<DOM::Node const*> visited_ancestors;
+    HashTable<DOM::Node const*> visited_ancestors_with_siblings;
+
     auto nodes = move(m_pending_nodes_for_style_invalidation_due_to_presence_of_has);
-    for (auto const& node : nodes) {
+    for (auto const& [weak_node, scope] : nodes) {
+        auto node = weak_node.ptr();
         if (!node)
             continue;
-        for (auto ancestor = node.ptr(); ancestor; ancestor = ancestor->parent_or_shadow_host()) {
-            if (!ancestor->is_element())
+
+        // The node itself is an anchor candidate when it's the parent of a removed child.
+        if (auto* element = as_if<DOM::Element>(*node))
+            element->invalidate_style_if_affected_by_has();
+
+        if (has_flag(scope, HasInvalidationScope::Siblings) || has_flag(scope, HasInvalidationScope::AncestorSiblings))
+            invalidate_siblings(*node);
+
+        if (!has_flag(scope, HasInvalidationScope::Ancestors) && !has_flag(scope, HasInvalidationScope::AncestorSiblings)) {
+            if (has_flag(scope, HasInvalidationScope::Parent)) {
+                if (auto* parent_element = as_if<DOM::Element>(node->parent_or_shadow_host()))
+                    parent_element->invalidate_style_if_affected_by_has();
+            }
+            continue;
+        }
+
+        bool include_ancestor_siblings = has_flag(scope, HasInvalidationScope::AncestorSiblings);
+        for (auto* ancestor = node->parent_or_shadow_host(); ancestor; ancestor = ancestor->parent_or_shadow_host()) {
+            if (visited_ancestors_with_siblings.contains(ancestor))
+                break;
+            if (!include_ancestor_siblings && visited_ancestors.set(ancestor) == AK::HashSetResult::KeptExistingEntry)
+                break;
+            if (include_ancestor_siblings)
+                visited_ancestors_with_siblings.set(ancestor);
+
+            auto* element = as_if<DOM::Element>(*ancestor);
+            if (!element)
                 continue;
-            auto& element = static_cast<DOM::Element&>(*ancestor);
-            element.invalidate_style_if_affected_by_has();
-
-            auto* parent = ancestor->parent_or_shadow_host();
-            if (!parent)
-                return;
-
-            // If any ancestor's sibling was tested against selectors like ".a:has(+ .b)" or ".a:has(~ .b)"
-            // its style might be affected by the change in descendant node.
-            parent->for_each_child_of_type<DOM::Element>([&](auto& ancestor_sibling_element) {
-                if (ancestor_sibling_element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
-                    ancestor_sibling_element.invalidate_style_if_affected_by_has();
-                return IterationDecision::Continue;
-            });
+            element->invalidate_style_if_affected_by_has();
+            if (include_ancestor_siblings)
+                invalidate_siblings(*element);
         }
     }
 }
-
-}
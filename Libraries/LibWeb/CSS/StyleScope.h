@@ -13,6 +13,7 @@
 #include <LibGC/Ptr.h>
 #include <LibWeb/Animations/KeyframeEffect.h>
 #include <LibWeb/CSS/CascadeOrigin.h>
+#include <LibWeb/CSS/PseudoClassBitmap.h>
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/StyleInvalidationData.h>
 #include <LibWeb/Forward.h>
@@ -33,6 +34,10 @@ struct MatchingRule {
     bool contains_pseudo_element { false };
     bool slotted { false };
 
+    // Copied from the selector, so that rejecting the rule with the ancestor filter only touches the rule itself.
+    bool can_use_ancestor_filter { false };
+    Array<u32, 8> ancestor_hashes {};
+
     // Helpers to deal with the fact that `rule` might be a CSSStyleRule or a CSSNestedDeclarations
     CSSStyleProperties const& declaration() const;
     SelectorList const& absolutized_selectors() const;
@@ -44,6 +49,11 @@ struct RuleCache {
     HashMap<FlyString, Vector<MatchingRule>> rules_by_class;
     HashMap<FlyString, Vector<MatchingRule>> rules_by_tag_name;
     HashMap<FlyString, Vector<MatchingRule>, AK::ASCIICaseInsensitiveFlyStringTraits> rules_by_attribute_name;
+    // Rules whose rightmost compound has an [attribute=value] selector, keyed by attribute_value_bucket_hash().
+    HashMap<u32, Vector<MatchingRule>> rules_by_attribute_value;
+    // Rules whose rightmost compound has nothing better to bucket by than a pseudo-class that only depends on
+    // the state of the element itself, like :hover or :checked.
+    HashMap<PseudoClass, Vector<MatchingRule>> rules_by_pseudo_class;
     Array<Vector<MatchingRule>, to_underlying(CSS::PseudoElement::KnownPseudoElementCount)> rules_by_pseudo_element;
     Vector<MatchingRule> root_rules;
     Vector<MatchingRule> slotted_rules;
@@ -52,7 +62,11 @@ struct RuleCache {
     HashMap<FlyString, NonnullRefPtr<Animations::KeyframeEffect::KeyFrameSet>> rules_by_animation_keyframes;
 
     void add_rule(MatchingRule const&, Optional<PseudoElement>, bool contains_root_pseudo_class);
-    void for_each_matching_rules(DOM::AbstractElement, Function<IterationDecision(Vector<MatchingRule> const&)> callback) const;
+    // Rules bucketed by a pseudo-class are passed along with that pseudo-class, so that callers can skip them when the
+    // element doesn't match it. Other rules come with an empty Optional.
+    void for_each_matching_rules(DOM::AbstractElement, Function<IterationDecision(Vector<MatchingRule> const&, Optional<PseudoClass>)> callback) const;
+
+    static u32 attribute_value_bucket_hash(FlyString const& attribute_name, StringView value);
 };
 
 struct RuleCaches {
@@ -62,6 +76,7 @@ struct RuleCaches {
 
 struct SelectorInsights {
     bool has_has_selectors { false };
+    HashTable<FlyString, AK::ASCIICaseInsensitiveFlyStringTraits> attribute_names;
 };
 
 class StyleScope {
@@ -94,12 +109,14 @@ public:
 
     [[nodiscard]] bool may_have_has_selectors() const;
     [[nodiscard]] bool have_has_selectors() const;
+    [[nodiscard]] bool is_attribute_name_used_in_selectors(FlyString const& attribute_name) const;
 
     void for_each_active_css_style_sheet(Function<void(CSS::CSSStyleSheet&)>&& callback) const;
 
     void invalidate_style_of_elements_affected_by_has();
 
-    void schedule_ancestors_style_invalidation_due_to_presence_of_has(DOM::Node& node) { m_pending_nodes_for_style_invalidation_due_to_presence_of_has.set(node); }
+    void schedule_ancestors_style_invalidation_due_to_presence_of_has(DOM::Node&, HasInvalidationScope);
+    [[nodiscard]] HasInvalidationScope has_invalidation_scope_for_structural_changes() const;
 
     void visit_edges(GC::Cell::Visitor&);
 
@@ -113,7 +130,7 @@ public:
 
     GC::Ptr<CSSStyleSheet> m_user_style_sheet;
 
-    HashTable<GC::Weak<DOM::Node>> m_pending_nodes_for_style_invalidation_due_to_presence_of_has;
+    HashMap<GC::Weak<DOM::Node>, HasInvalidationScope> m_pending_nodes_for_style_invalidation_due_to_presence_of_has;
 
     GC::Ref<DOM::Node> m_node;
 };
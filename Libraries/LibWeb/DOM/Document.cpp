@@ -44,6 +44,7 @@
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/CSS/StyleComputer.h>
+#include <LibWeb/CSS/StyleRecalcTrace.h>
 #include <LibWeb/CSS/StyleSheetIdentifier.h>
 #include <LibWeb/CSS/StyleValues/ColorSchemeStyleValue.h>
 #include <LibWeb/CSS/StyleValues/GuaranteedInvalidStyleValue.h>
@@ -77,6 +78,7 @@
 #include <LibWeb/DOM/Position.h>
 #include <LibWeb/DOM/ProcessingInstruction.h>
 #include <LibWeb/DOM/Range.h>
+#include <LibWeb/DOM/RenderingPhaseTimings.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/DOM/StyleInvalidator.h>
 #include <LibWeb/DOM/Text.h>
@@ -467,7 +469,7 @@ Document::Document(JS::Realm& realm, URL::URL const& url, TemporaryDocumentForFr
     , m_url(url)
     , m_temporary_document_for_fragment_parsing(temporary_document_for_fragment_parsing)
     , m_editing_host_manager(EditingHostManager::create(realm, *this))
-    , m_dynamic_view_transition_style_sheet(parse_css_stylesheet(CSS::Parser::ParsingParams(realm), ""sv, {}))
+    , m_dynamic_view_transition_style_sheet(parse_css_stylesheet(CSS::Parser::ParsingParams(realm), String {}, {}))
     , m_style_invalidator(realm.heap().allocate<StyleInvalidator>())
     , m_style_scope(*this)
 {
@@ -495,6 +497,9 @@ Document::Document(JS::Realm& realm, URL::URL const& url, TemporaryDocumentForFr
     });
 
     HTML::main_thread_event_loop().register_document({}, *this);
+
+    if (rendering_phase_timings_enabled())
+        start_recording_rendering_phase_timings();
 }
 
 Document::~Document() = default;
@@ -550,6 +555,8 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_page);
     visitor.visit(m_window);
     visitor.visit(m_layout_root);
+    if (m_previous_layout_state)
+        m_previous_layout_state->visit_edges(visitor);
     visitor.visit(m_style_sheets);
     visitor.visit(m_hovered_node);
     visitor.visit(m_inspected_node);
@@ -1115,6 +1122,7 @@ void Document::tear_down_layout_tree()
 {
     m_layout_root = nullptr;
     m_paintable = nullptr;
+    m_previous_layout_state = nullptr;
     m_needs_full_layout_tree_update = true;
 }
 
@@ -1366,6 +1374,7 @@ void Document::update_layout(UpdateLayoutReason reason)
     auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
 
     if (!m_layout_root || needs_layout_tree_update() || child_needs_layout_tree_update() || needs_full_layout_tree_update()) {
+        RenderingPhaseTimings::PhaseTimer layout_tree_build_timer { m_rendering_phase_timings.ptr(), RenderingPhaseTimings::Phase::LayoutTreeBuild };
         Layout::TreeBuilder tree_builder;
         m_layout_root = as<Layout::Viewport>(*tree_builder.build(*this));
 
@@ -1414,28 +1423,35 @@ void Document::update_layout(UpdateLayoutReason reason)
         return TraversalDecision::Continue;
     });
 
-    Layout::LayoutState layout_state;
+    // NOTE: The previous layout state is handed to the new one so that formatting context roots whose contents are
+    //       clean and laid out with unchanged inputs can carry over their used values instead of being laid out again.
+    auto layout_state = make<Layout::LayoutState>(m_previous_layout_state.ptr());
 
     {
-        Layout::BlockFormattingContext root_formatting_context(layout_state, Layout::LayoutMode::Normal, *m_layout_root, nullptr);
+        RenderingPhaseTimings::PhaseTimer layout_timer { m_rendering_phase_timings.ptr(), RenderingPhaseTimings::Phase::Layout };
+        Layout::BlockFormattingContext root_formatting_context(*layout_state, Layout::LayoutMode::Normal, *m_layout_root, nullptr);
 
         auto& viewport = static_cast<Layout::Viewport&>(*m_layout_root);
-        auto& viewport_state = layout_state.get_mutable(viewport);
+        auto& viewport_state = layout_state->get_mutable(viewport);
         viewport_state.set_content_width(viewport_rect.width());
         viewport_state.set_content_height(viewport_rect.height());
 
         if (document_element && document_element->layout_node()) {
-            auto& icb_state = layout_state.get_mutable(as<Layout::NodeWithStyleAndBoxModelMetrics>(*document_element->layout_node()));
+            auto& icb_state = layout_state->get_mutable(as<Layout::NodeWithStyleAndBoxModelMetrics>(*document_element->layout_node()));
             icb_state.set_content_width(viewport_rect.width());
         }
 
-        root_formatting_context.run(
+        Layout::FormattingContext::run_with_timing(root_formatting_context,
             Layout::AvailableSpace(
                 Layout::AvailableSize::make_definite(viewport_rect.width()),
                 Layout::AvailableSize::make_definite(viewport_rect.height())));
     }
 
-    layout_state.commit(*m_layout_root);
+    {
+        RenderingPhaseTimings::PhaseTimer paintable_tree_build_timer { m_rendering_phase_timings.ptr(), RenderingPhaseTimings::Phase::PaintableTreeBuild };
+        layout_state->commit(*m_layout_root);
+    }
+    m_previous_layout_state = layout_state->retain_reusable_layouts();
 
     // Broadcast the current viewport rect to any new paintables, so they know whether they're visible or not.
     inform_all_viewport_clients_about_the_current_viewport_rect();
@@ -1480,9 +1496,78 @@ void Document::update_layout(UpdateLayoutReason reason)
     }
 }
 
-[[nodiscard]] static CSS::RequiredInvalidationAfterStyleChange update_style_recursively(Node& node, CSS::StyleComputer& style_computer, bool needs_inherited_style_update, bool recompute_elements_depending_on_custom_properties)
+// The descendants of a display:none element don't need up-to-date style until something asks for it, so we can
+// skip styling them, as long as nothing in the subtree can be rendered or referenced from elsewhere while the
+// element stays hidden: top layer elements get laid out regardless of their ancestors, and SVG resources such as
+// gradients or symbols can be used by rendered content.
+// Deferring also clears the descendants' style update flags, so that a later invalidation of any of them still
+// propagates up and brings us back here.
+static bool defer_style_update_for_descendants_if_possible(Element& element)
+{
+    if (element.namespace_uri() != Namespace::HTML)
+        return false;
+
+    bool can_defer = true;
+    Vector<GC::Ref<Node>> descendants_with_style_update_flags;
+    Vector<GC::Ref<Element>> descendant_elements;
+    element.for_each_shadow_including_descendant([&](Node& descendant) {
+        if (auto* descendant_element = as_if<Element>(descendant)) {
+            if (descendant_element->is_svg_element() || descendant_element->rendered_in_top_layer()) {
+                can_defer = false;
+                return TraversalDecision::Break;
+            }
+            descendant_elements.append(*descendant_element);
+        }
+        if (descendant.needs_style_update() || descendant.child_needs_style_update())
+            descendants_with_style_update_flags.append(descendant);
+        return TraversalDecision::Continue;
+    });
+    if (!can_defer)
+        return false;
+
+    for (auto& descendant : descendants_with_style_update_flags) {
+        descendant->set_needs_style_update(false);
+        descendant->set_child_needs_style_update(false);
+    }
+    for (auto& descendant_element : descendant_elements)
+        descendant_element->set_has_deferred_style(true);
+    element.set_has_deferred_descendant_style(true);
+    return true;
+}
+
+// Whether the box generated for an element after a style change can take the place of its current box among its
+// siblings, so that only the element's own subtree has to be rebuilt. Changes that affect how the box is placed in its
+// parent (to or from "display: none" or "contents", between block-level and inline-level, in or out of flow), as well
+// as inline boxes that may have been split around block-level descendants, need the parent rebuilt instead. So do
+// table roots, which sit inside an anonymous table wrapper that only gets generated along with them.
+static bool new_box_can_replace_old_box(Element const& element)
+{
+    auto old_box = element.layout_node();
+    if (!old_box || !old_box->parent() || element.rendered_in_top_layer())
+        return false;
+
+    auto old_display = old_box->display();
+    auto new_display = element.computed_properties()->display();
+    if (old_display.is_table_inside() || new_display.is_table_inside() || old_box->has_been_wrapped_in_table_wrapper())
+        return false;
+    auto display_affects_parent = [](CSS::Display const& display) {
+        return !display.is_outside_and_inside() || display.is_list_item() || (display.is_inline_outside() && display.is_flow_inside());
+    };
+    if (display_affects_parent(old_display) || display_affects_parent(new_display))
+        return false;
+    if (old_display.is_inline_outside() != new_display.is_inline_outside())
+        return false;
+
+    auto is_out_of_flow = [](CSS::Positioning position, CSS::Float float_) {
+        return position == CSS::Positioning::Absolute || position == CSS::Positioning::Fixed || float_ != CSS::Float::None;
+    };
+    auto const& old_values = old_box->computed_values();
+    auto const& new_properties = *element.computed_properties();
+    return is_out_of_flow(old_values.position(), old_values.float_()) == is_out_of_flow(new_properties.position(), new_properties.float_());
+}
+
+[[nodiscard]] static CSS::RequiredInvalidationAfterStyleChange update_style_recursively(Node& node, CSS::StyleComputer& style_computer, bool needs_full_style_update, bool needs_inherited_style_update, bool recompute_elements_depending_on_custom_properties)
 {
-    bool const needs_full_style_update = node.document().needs_full_style_update();
     CSS::RequiredInvalidationAfterStyleChange invalidation;
 
     if (node.is_element())
@@ -1490,7 +1575,7 @@ void Document::update_layout(UpdateLayoutReason reason)
 
     // NOTE: If the current node has `display:none`, we can disregard all invalidation
     //       caused by its children, as they will not be rendered anyway.
-    //       We will still recompute style for the children, though.
+    //       Where possible, we don't even recompute style for the children until it's needed.
     bool is_display_none = false;
 
     bool did_change_custom_properties = false;
@@ -1508,9 +1593,10 @@ void Document::update_layout(UpdateLayoutReason reason)
         node.layout_node()->set_needs_layout_update(SetNeedsLayoutReason::StyleChange);
     }
     if (node_invalidation.rebuild_layout_tree) {
-        // We mark layout tree for rebuild starting from parent element to correctly invalidate
-        // "display" property change to/from "contents" value.
-        if (auto parent_element = node.parent_element()) {
+        // We mark layout tree for rebuild starting from parent element to correctly invalidate e.g. "display" property
+        // change to/from "contents" value, unless the element's new box can simply replace its old one.
+        auto parent_element = node.parent_element();
+        if (parent_element && (node_invalidation.rebuild_layout_tree_from_parent || !new_box_can_replace_old_box(static_cast<Element&>(node)))) {
             parent_element->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::StyleChange);
         } else {
             node.set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::StyleChange);
@@ -1524,11 +1610,24 @@ void Document::update_layout(UpdateLayoutReason reason)
     }
 
     bool children_need_inherited_style_update = !invalidation.is_none();
-    if (needs_full_style_update || node.child_needs_style_update() || children_need_inherited_style_update || recompute_elements_depending_on_custom_properties) {
+    bool children_need_full_style_update = needs_full_style_update;
+    bool should_update_children = needs_full_style_update || node.child_needs_style_update() || children_need_inherited_style_update || recompute_elements_depending_on_custom_properties;
+    if (auto* element = as_if<Element>(node)) {
+        if (is_display_none && should_update_children && defer_style_update_for_descendants_if_possible(*element)) {
+            should_update_children = false;
+        } else if (element->has_deferred_descendant_style() && (should_update_children || !is_display_none)) {
+            // We don't know what changed while the descendants' style was deferred, so restyle all of them.
+            element->set_has_deferred_descendant_style(false);
+            children_need_full_style_update = true;
+            should_update_children = true;
+        }
+    }
+
+    if (should_update_children) {
         if (node.is_element()) {
             if (auto shadow_root = static_cast<DOM::Element&>(node).shadow_root()) {
-                if (needs_full_style_update || shadow_root->needs_style_update() || shadow_root->child_needs_style_update()) {
-                    auto subtree_invalidation = update_style_recursively(*shadow_root, style_computer, children_need_inherited_style_update, recompute_elements_depending_on_custom_properties);
+                if (children_need_full_style_update || shadow_root->needs_style_update() || shadow_root->child_needs_style_update()) {
+                    auto subtree_invalidation = update_style_recursively(*shadow_root, style_computer, children_need_full_style_update, children_need_inherited_style_update, recompute_elements_depending_on_custom_properties);
                     if (!is_display_none)
                         invalidation |= subtree_invalidation;
                 }
@@ -1536,8 +1635,8 @@ void Document::update_layout(UpdateLayoutReason reason)
         }
 
         node.for_each_child([&](auto& child) {
-            if (needs_full_style_update || child.needs_style_update() || children_need_inherited_style_update || child.child_needs_style_update() || recompute_elements_depending_on_custom_properties) {
-                auto subtree_invalidation = update_style_recursively(child, style_computer, children_need_inherited_style_update, recompute_elements_depending_on_custom_properties);
+            if (children_need_full_style_update || child.needs_style_update() || children_need_inherited_style_update || child.child_needs_style_update() || recompute_elements_depending_on_custom_properties) {
+                auto subtree_invalidation = update_style_recursively(child, style_computer, children_need_full_style_update, children_need_inherited_style_update, recompute_elements_depending_on_custom_properties);
                 if (!is_display_none)
                     invalidation |= subtree_invalidation;
             }
@@ -1577,6 +1676,15 @@ void Document::update_style()
     if (!m_style_invalidator->has_pending_invalidations() && !needs_full_style_update() && !needs_style_update() && !child_needs_style_update())
         return;
 
+    auto* style_recalc_trace = style_computer().style_recalc_trace();
+    if (style_recalc_trace)
+        style_recalc_trace->begin_style_update(style_computer().rule_matching_statistics(), needs_full_style_update());
+    ScopeGuard end_style_recalc_trace = [&] {
+        if (style_recalc_trace)
+            style_recalc_trace->end_style_update(style_computer().rule_matching_statistics());
+    };
+    RenderingPhaseTimings::PhaseTimer style_timer { m_rendering_phase_timings.ptr(), RenderingPhaseTimings::Phase::Style };
+
     m_style_invalidator->invalidate(*this);
 
     // NOTE: If this is a document hosting <template> contents, style update is unnecessary.
@@ -1588,9 +1696,11 @@ void Document::update_style()
 
     evaluate_media_rules();
 
-    style_computer().reset_ancestor_filter();
-
-    auto invalidation = update_style_recursively(*this, style_computer(), false, false);
+    auto invalidation = [&] {
+        TemporaryChange is_computing_style { m_is_computing_style, true };
+        CSS::StyleComputer::TraversalScope traversal_scope { style_computer(), *this };
+        return update_style_recursively(*this, style_computer(), needs_full_style_update(), false, false);
+    }();
     if (!invalidation.is_none())
         invalidate_display_list();
     if (invalidation.rebuild_stacking_context_tree)
@@ -1598,6 +1708,31 @@ void Document::update_style()
     m_needs_full_style_update = false;
 }
 
+void Document::update_deferred_style_for(Element& element)
+{
+    // NOTE: Elements taken out of the document keep their stale style until they're inserted somewhere again.
+    if (!element.has_deferred_style() || m_is_computing_style || !element.is_connected())
+        return;
+
+    // Everything we inherit from whose style was deferred too may be stale, so we restyle that whole chain, top-down so
+    // each element inherits from fresh style.
+    Vector<GC::Ref<Element>> inheritance_chain;
+    for (Optional<AbstractElement> ancestor = AbstractElement { element }; ancestor.has_value() && ancestor->element().has_deferred_style(); ancestor = ancestor->element_to_inherit_style_from())
+        inheritance_chain.append(ancestor->element());
+
+    TemporaryChange is_computing_style { m_is_computing_style, true };
+    CSS::StyleComputer::TraversalScope traversal_scope { style_computer(), *inheritance_chain.last() };
+    for (size_t i = inheritance_chain.size(); i-- > 0;) {
+        auto& element_to_restyle = inheritance_chain[i];
+        bool did_change_custom_properties = false;
+        // NOTE: Nothing in a display:none subtree has a layout node, so there's nothing to invalidate.
+        (void)element_to_restyle->recompute_style(did_change_custom_properties);
+        style_computer().push_ancestor(*element_to_restyle);
+    }
+    for (auto& element_to_restyle : inheritance_chain)
+        style_computer().pop_ancestor(*element_to_restyle);
+}
+
 void Document::update_animated_style_if_needed()
 {
     if (!m_needs_animated_style_update)
@@ -1631,6 +1766,20 @@ void Document::update_paint_and_hit_testing_properties_if_needed()
     }
 }
 
+void Document::start_recording_rendering_phase_timings()
+{
+    m_rendering_phase_timings = make<RenderingPhaseTimings>();
+}
+
+String Document::stop_recording_rendering_phase_timings()
+{
+    if (!m_rendering_phase_timings)
+        return {};
+    auto json = m_rendering_phase_timings->to_json();
+    m_rendering_phase_timings = nullptr;
+    return json;
+}
+
 void Document::set_normal_link_color(Color color)
 {
     m_normal_link_color = color;
@@ -1830,7 +1979,7 @@ void Document::invalidate_style_for_elements_affected_by_pseudo_class_change(CSS
 
     auto matches_different_set_of_rules_after_state_change = [&](Element& element) {
         bool result = false;
-        rules.for_each_matching_rules({ element }, [&](auto& rules) {
+        rules.for_each_matching_rules({ element }, [&](auto& rules, auto) {
             for (auto& rule : rules) {
                 bool before = does_rule_match_on_element(element, rule);
                 TemporaryChange change { element_slot, node };
@@ -1863,6 +2012,7 @@ void Document::invalidate_style_for_elements_affected_by_pseudo_class_change(CSS
             style_computer.pop_ancestor(static_cast<Element&>(node));
     };
 
+    CSS::StyleComputer::TraversalScope traversal_scope { style_computer, root };
     invalidate_affected_elements_recursively(root);
 }
 
@@ -6499,6 +6649,13 @@ RefPtr<Painting::DisplayList> Document::record_display_list(HTML::PaintConfig co
         return m_cached_display_list;
     }
 
+    // NOTE: Recording a display list completes a rendering update, so its time is attributed before finishing it.
+    ScopeGuard finish_rendering_phase_timings_update = [&] {
+        if (m_rendering_phase_timings)
+            m_rendering_phase_timings->finish_update();
+    };
+    RenderingPhaseTimings::PhaseTimer display_list_recording_timer { m_rendering_phase_timings.ptr(), RenderingPhaseTimings::Phase::DisplayListRecording };
+
     auto display_list = Painting::DisplayList::create(page().client().device_pixels_per_css_pixel());
     Painting::DisplayListRecorder display_list_recorder(display_list);
 
@@ -351,8 +351,16 @@ public:
     void obtain_theme_color();
 
     void update_style();
+    // Computes up-to-date style for an element inside a display:none subtree whose style update was deferred. Called by
+    // the element's accessors for its computed and custom properties.
+    void update_deferred_style_for(Element&);
     void update_layout(UpdateLayoutReason);
     void update_paint_and_hit_testing_properties_if_needed();
+
+    // Opt-in timings of each phase of the rendering pipeline, see RenderingPhaseTimings.
+    void start_recording_rendering_phase_timings();
+    [[nodiscard]] String stop_recording_rendering_phase_timings();
+    [[nodiscard]] RenderingPhaseTimings* rendering_phase_timings() const { return m_rendering_phase_timings.ptr(); }
     void update_animated_style_if_needed();
 
     void invalidate_layout_tree(InvalidateLayoutTreeReason);
@@ -1017,6 +1025,8 @@ private:
     GC::Ptr<HTML::Window> m_window;
 
     GC::Ptr<Layout::Viewport> m_layout_root;
+    OwnPtr<Layout::LayoutState> m_previous_layout_state;
+    OwnPtr<RenderingPhaseTimings> m_rendering_phase_timings;
 
     GC::Ptr<Node> m_hovered_node;
     GC::Ptr<Node> m_inspected_node;
@@ -1242,6 +1252,9 @@ private:
     // https://drafts.csswg.org/css-transitions-2/#current-transition-generation
     size_t m_transition_generation { 0 };
 
+    // Set while style is being computed, during which deferred style is never brought up to date on demand.
+    bool m_is_computing_style { false };
+
     bool m_needs_to_call_page_did_load { false };
 
     // https://html.spec.whatwg.org/multipage/browsing-the-web.html#scripts-may-run-for-the-newly-created-document
@@ -712,6 +712,7 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style(bool& did_cha
 {
     VERIFY(parent());
 
+    m_has_deferred_style = false;
     m_style_uses_attr_css_function = false;
     m_style_uses_var_css_function = false;
     m_affected_by_has_pseudo_class_in_subject_position = false;
@@ -724,7 +725,11 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style(bool& did_cha
     m_sibling_invalidation_distance = 0;
 
     auto& style_computer = document().style_computer();
-    auto new_computed_properties = style_computer.compute_style({ *this }, did_change_custom_properties);
+    auto new_computed_properties = style_computer.share_style_with_sibling_if_possible(*this, did_change_custom_properties);
+    if (!new_computed_properties) {
+        new_computed_properties = style_computer.compute_style({ *this }, did_change_custom_properties);
+        style_computer.add_style_sharing_candidate(*this);
+    }
 
     // Tables must not inherit -libweb-* values for text-align.
     // FIXME: Find the spec for this.
@@ -738,7 +743,7 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style(bool& did_cha
 
     CSS::RequiredInvalidationAfterStyleChange invalidation;
     if (m_computed_properties) {
-        invalidation = compute_required_invalidation(*m_computed_properties, new_computed_properties);
+        invalidation = compute_required_invalidation(*m_computed_properties, *new_computed_properties);
         had_list_marker = m_computed_properties->display().is_list_item();
     } else {
         invalidation = CSS::RequiredInvalidationAfterStyleChange::full();
@@ -3067,8 +3072,16 @@ void Element::set_cascaded_properties(Optional<CSS::PseudoElement> pseudo_elemen
     }
 }
 
+void Element::resolve_deferred_style_if_needed() const
+{
+    if (m_has_deferred_style) [[unlikely]]
+        const_cast<Document&>(document()).update_deferred_style_for(const_cast<Element&>(*this));
+}
+
 GC::Ptr<CSS::ComputedProperties> Element::computed_properties(Optional<CSS::PseudoElement> pseudo_element_type)
 {
+    resolve_deferred_style_if_needed();
+
     if (pseudo_element_type.has_value()) {
         if (auto pseudo_element = get_pseudo_element(*pseudo_element_type); pseudo_element.has_value())
             return pseudo_element->computed_properties();
@@ -3079,6 +3092,8 @@ GC::Ptr<CSS::ComputedProperties> Element::computed_properties(Optional<CSS::Pseu
 
 GC::Ptr<CSS::ComputedProperties const> Element::computed_properties(Optional<CSS::PseudoElement> pseudo_element_type) const
 {
+    resolve_deferred_style_if_needed();
+
     if (pseudo_element_type.has_value()) {
         if (auto pseudo_element = get_pseudo_element(*pseudo_element_type); pseudo_element.has_value())
             return pseudo_element->computed_properties();
@@ -3151,6 +3166,8 @@ OrderedHashMap<FlyString, CSS::StyleProperty> const& Element::custom_properties(
 {
     static OrderedHashMap<FlyString, CSS::StyleProperty> s_empty_custom_properties;
 
+    resolve_deferred_style_if_needed();
+
     if (!pseudo_element.has_value())
         return m_custom_properties;
 
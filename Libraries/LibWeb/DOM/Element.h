@@ -432,6 +432,16 @@ public:
     void set_rendered_in_top_layer(bool rendered_in_top_layer) { m_rendered_in_top_layer = rendered_in_top_layer; }
     bool rendered_in_top_layer() const { return m_rendered_in_top_layer; }
 
+    // Set while this element is display:none and the style of its descendants hasn't been brought up to date.
+    // Those descendants are then fully restyled once this element is rendered again, or on demand.
+    bool has_deferred_descendant_style() const { return m_has_deferred_descendant_style; }
+    void set_has_deferred_descendant_style(bool value) { m_has_deferred_descendant_style = value; }
+
+    // Set on the elements of a display:none subtree whose style update was deferred, until their style is brought up to
+    // date. Reading their computed or custom properties does that on demand.
+    bool has_deferred_style() const { return m_has_deferred_style; }
+    void set_has_deferred_style(bool value) { m_has_deferred_style = value; }
+
     bool has_non_empty_counters_set() const { return m_counters_set; }
     Optional<CSS::CountersSet const&> counters_set() const;
     CSS::CountersSet& ensure_counters_set();
@@ -539,6 +549,7 @@ private:
     FlyString make_html_uppercased_qualified_name() const;
 
     void invalidate_style_after_attribute_change(FlyString const& attribute_name, Optional<String> const& old_value, Optional<String> const& new_value);
+    void resolve_deferred_style_if_needed() const;
 
     WebIDL::ExceptionOr<GC::Ptr<Node>> insert_adjacent(StringView where, GC::Ref<Node> node);
 
@@ -609,6 +620,8 @@ private:
 
     bool m_in_top_layer : 1 { false };
     bool m_rendered_in_top_layer : 1 { false };
+    bool m_has_deferred_descendant_style : 1 { false };
+    bool m_has_deferred_style : 1 { false };
     bool m_style_uses_attr_css_function : 1 { false };
     bool m_style_uses_var_css_function : 1 { false };
     bool m_style_uses_tree_counting_function : 1 { false };
@@ -18,6 +18,7 @@
 #include <LibWeb/Bindings/NodePrototype.h>
 #include <LibWeb/CSS/ComputedProperties.h>
 #include <LibWeb/CSS/StyleComputer.h>
+#include <LibWeb/CSS/StyleRecalcTrace.h>
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/CDATASection.h>
 #include <LibWeb/DOM/Comment.h>
@@ -403,7 +404,7 @@ GC::Ptr<HTML::Navigable> Node::navigable() const
     return navigable;
 }
 
-[[maybe_unused]] static StringView to_string(StyleInvalidationReason reason)
+StringView to_string(StyleInvalidationReason reason)
 {
 #define __ENUMERATE_STYLE_INVALIDATION_REASON(reason) \
     case StyleInvalidationReason::reason:             \
@@ -420,20 +421,26 @@ void Node::invalidate_style(StyleInvalidationReason reason)
     if (is_character_data())
         return;
 
+    if (auto* style_recalc_trace = document().style_computer().style_recalc_trace())
+        style_recalc_trace->did_invalidate_style(*this, reason);
+
     auto& style_scope = root().is_shadow_root() ? static_cast<ShadowRoot&>(root()).style_scope() : document().style_scope();
 
     if (style_scope.may_have_has_selectors()) {
+        auto has_invalidation_scope = style_scope.has_invalidation_scope_for_structural_changes();
         if (reason == StyleInvalidationReason::NodeRemove) {
             if (auto* parent = parent_or_shadow_host(); parent) {
-                style_scope.schedule_ancestors_style_invalidation_due_to_presence_of_has(*parent);
-                parent->for_each_child_of_type<Element>([&](auto& element) {
-                    if (element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
-                        element.invalidate_style_if_affected_by_has();
-                    return IterationDecision::Continue;
-                });
+                style_scope.schedule_ancestors_style_invalidation_due_to_presence_of_has(*parent, has_invalidation_scope);
+                if (has_flag(has_invalidation_scope, CSS::HasInvalidationScope::Siblings) || has_flag(has_invalidation_scope, CSS::HasInvalidationScope::AncestorSiblings)) {
+                    parent->for_each_child_of_type<Element>([&](auto& element) {
+                        if (element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+                            element.invalidate_style_if_affected_by_has();
+                        return IterationDecision::Continue;
+                    });
+                }
             }
         } else {
-            style_scope.schedule_ancestors_style_invalidation_due_to_presence_of_has(*this);
+            style_scope.schedule_ancestors_style_invalidation_due_to_presence_of_has(*this, has_invalidation_scope);
         }
     }
 
@@ -509,17 +516,16 @@ void Node::invalidate_style(StyleInvalidationReason reason, Vector<CSS::Invalida
             shadow_style_scope = &element_shadow_root->style_scope();
     }
 
-    bool properties_used_in_has_selectors = false;
+    auto has_invalidation_scope = CSS::HasInvalidationScope::None;
+    auto shadow_has_invalidation_scope = CSS::HasInvalidationScope::None;
     for (auto const& property : properties) {
-        properties_used_in_has_selectors |= document().style_computer().invalidation_property_used_in_has_selector(property, style_scope);
+        has_invalidation_scope |= document().style_computer().has_invalidation_scope_for_property(property, style_scope);
         if (shadow_style_scope)
-            properties_used_in_has_selectors |= document().style_computer().invalidation_property_used_in_has_selector(property, *shadow_style_scope);
-    }
-    if (properties_used_in_has_selectors) {
-        style_scope.schedule_ancestors_style_invalidation_due_to_presence_of_has(*this);
-        if (shadow_style_scope)
-            shadow_style_scope->schedule_ancestors_style_invalidation_due_to_presence_of_has(*this);
+            shadow_has_invalidation_scope |= document().style_computer().has_invalidation_scope_for_property(property, *shadow_style_scope);
     }
+    style_scope.schedule_ancestors_style_invalidation_due_to_presence_of_has(*this, has_invalidation_scope);
+    if (shadow_style_scope)
+        shadow_style_scope->schedule_ancestors_style_invalidation_due_to_presence_of_has(*this, shadow_has_invalidation_scope);
 
     auto invalidate_for_style_scope = [this, reason, &properties, &options](CSS::StyleScope& style_scope) {
         auto invalidation_set = document().style_computer().invalidation_set_for_properties(properties, style_scope);
@@ -529,6 +535,9 @@ void Node::invalidate_style(StyleInvalidationReason reason, Vector<CSS::Invalida
             return;
         }
 
+        if (auto* style_recalc_trace = document().style_computer().style_recalc_trace())
+            style_recalc_trace->did_invalidate_style(*this, reason, properties.span());
+
         if (options.invalidate_self || invalidation_set.needs_invalidate_self()) {
             set_needs_style_update(true);
         }
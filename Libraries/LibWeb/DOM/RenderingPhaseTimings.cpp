@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AllOf.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <LibWeb/DOM/RenderingPhaseTimings.h>
+
+namespace Web::DOM {
+
+static bool g_enable_rendering_phase_timings = false;
+
+void set_enable_rendering_phase_timings(bool enabled)
+{
+    g_enable_rendering_phase_timings = enabled;
+}
+
+bool rendering_phase_timings_enabled()
+{
+    return g_enable_rendering_phase_timings;
+}
+
+bool RenderingPhaseTimings::Update::is_empty() const
+{
+    return all_of(phase_runs, [](auto runs) { return runs == 0; });
+}
+
+void RenderingPhaseTimings::add_time_spent_in_phase(Phase phase, AK::Duration duration)
+{
+    m_current_update.time_spent_in_phase[to_underlying(phase)] += duration;
+    ++m_current_update.phase_runs[to_underlying(phase)];
+}
+
+void RenderingPhaseTimings::begin_formatting_context(Layout::FormattingContext::Type type)
+{
+    m_running_formatting_contexts.append({ type, MonotonicTime::now(), {} });
+}
+
+void RenderingPhaseTimings::end_formatting_context()
+{
+    auto context = m_running_formatting_contexts.take_last();
+    auto elapsed = MonotonicTime::now() - context.start;
+
+    auto& timing = m_current_update.formatting_contexts[to_underlying(context.type)];
+    ++timing.runs;
+    timing.time += elapsed - context.time_spent_in_nested_contexts;
+
+    if (!m_running_formatting_contexts.is_empty())
+        m_running_formatting_contexts.last().time_spent_in_nested_contexts += elapsed;
+}
+
+void RenderingPhaseTimings::finish_update()
+{
+    if (m_current_update.is_empty())
+        return;
+    if (m_completed_updates.size() == m_completed_updates.capacity())
+        ++m_dropped_updates;
+    m_completed_updates.enqueue(m_current_update);
+    m_current_update = {};
+}
+
+static StringView phase_name(RenderingPhaseTimings::Phase phase)
+{
+    switch (phase) {
+    case RenderingPhaseTimings::Phase::Style:
+        return "style"sv;
+    case RenderingPhaseTimings::Phase::LayoutTreeBuild:
+        return "layoutTreeBuild"sv;
+    case RenderingPhaseTimings::Phase::Layout:
+        return "layout"sv;
+    case RenderingPhaseTimings::Phase::PaintableTreeBuild:
+        return "paintableTreeBuild"sv;
+    case RenderingPhaseTimings::Phase::DisplayListRecording:
+        return "displayListRecording"sv;
+    case RenderingPhaseTimings::Phase::__Count:
+        break;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static StringView formatting_context_type_name(Layout::FormattingContext::Type type)
+{
+    switch (type) {
+    case Layout::FormattingContext::Type::Block:
+        return "block"sv;
+    case Layout::FormattingContext::Type::Inline:
+        return "inline"sv;
+    case Layout::FormattingContext::Type::Flex:
+        return "flex"sv;
+    case Layout::FormattingContext::Type::Grid:
+        return "grid"sv;
+    case Layout::FormattingContext::Type::Table:
+        return "table"sv;
+    case Layout::FormattingContext::Type::SVG:
+        return "svg"sv;
+    case Layout::FormattingContext::Type::InternalReplaced:
+        return "internalReplaced"sv;
+    case Layout::FormattingContext::Type::InternalDummy:
+        return "internalDummy"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+String RenderingPhaseTimings::to_json() const
+{
+    JsonArray updates;
+    auto append_update = [&](Update const& update) {
+        JsonObject phases;
+        for (size_t i = 0; i < phase_count; ++i) {
+            JsonObject phase;
+            phase.set("runs"sv, update.phase_runs[i]);
+            phase.set("microseconds"sv, update.time_spent_in_phase[i].to_microseconds());
+            phases.set(phase_name(static_cast<Phase>(i)), move(phase));
+        }
+
+        JsonObject formatting_contexts;
+        for (size_t i = 0; i < formatting_context_type_count; ++i) {
+            auto const& timing = update.formatting_contexts[i];
+            if (timing.runs == 0)
+                continue;
+            JsonObject formatting_context;
+            formatting_context.set("runs"sv, timing.runs);
+            formatting_context.set("microseconds"sv, timing.time.to_microseconds());
+            formatting_contexts.set(formatting_context_type_name(static_cast<Layout::FormattingContext::Type>(i)), move(formatting_context));
+        }
+
+        JsonObject object;
+        object.set("phases"sv, move(phases));
+        object.set("formattingContexts"sv, move(formatting_contexts));
+        updates.must_append(move(object));
+    };
+
+    // The update in progress is listed last if anything has been recorded into it yet.
+    for (auto const& update : m_completed_updates)
+        append_update(update);
+    if (!m_current_update.is_empty())
+        append_update(m_current_update);
+
+    JsonObject timings;
+    timings.set("updates"sv, move(updates));
+    timings.set("droppedUpdates"sv, m_dropped_updates);
+    return timings.serialized();
+}
+
+}
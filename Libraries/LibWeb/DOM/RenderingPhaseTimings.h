@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/CircularQueue.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibWeb/Export.h>
+#include <LibWeb/Layout/FormattingContext.h>
+
+namespace Web::DOM {
+
+// An opt-in record of how long each phase of a document's rendering pipeline took, for benchmarking and catching
+// performance regressions.
+// Phases are accumulated into the current update until a display list is recorded, which completes the update. Layout
+// time is additionally broken down by formatting context type. A formatting context is only charged for the time spent
+// outside of the formatting contexts nested inside it, so the per-type times add up to the total layout time.
+class WEB_API RenderingPhaseTimings {
+    AK_MAKE_NONCOPYABLE(RenderingPhaseTimings);
+    AK_MAKE_NONMOVABLE(RenderingPhaseTimings);
+
+public:
+    enum class Phase : u8 {
+        Style,
+        LayoutTreeBuild,
+        Layout,
+        PaintableTreeBuild,
+        DisplayListRecording,
+        __Count,
+    };
+
+    static constexpr size_t phase_count = to_underlying(Phase::__Count);
+    static constexpr size_t formatting_context_type_count = to_underlying(Layout::FormattingContext::Type::InternalDummy) + 1;
+
+    struct FormattingContextTiming {
+        u64 runs { 0 };
+        AK::Duration time;
+    };
+
+    struct Update {
+        Array<AK::Duration, phase_count> time_spent_in_phase {};
+        Array<u64, phase_count> phase_runs {};
+        Array<FormattingContextTiming, formatting_context_type_count> formatting_contexts {};
+
+        bool is_empty() const;
+    };
+
+    // Adds the time between construction and destruction to the given phase, if there are timings to record to.
+    class PhaseTimer {
+        AK_MAKE_NONCOPYABLE(PhaseTimer);
+        AK_MAKE_NONMOVABLE(PhaseTimer);
+
+    public:
+        PhaseTimer(RenderingPhaseTimings* timings, Phase phase)
+            : m_timings(timings)
+            , m_phase(phase)
+        {
+            if (m_timings)
+                m_start = MonotonicTime::now();
+        }
+
+        ~PhaseTimer()
+        {
+            if (m_timings)
+                m_timings->add_time_spent_in_phase(m_phase, MonotonicTime::now() - *m_start);
+        }
+
+    private:
+        RenderingPhaseTimings* m_timings { nullptr };
+        Phase m_phase;
+        Optional<MonotonicTime> m_start;
+    };
+
+    // Attributes the time between construction and destruction to a formatting context of the given type, minus the
+    // time spent in formatting contexts started in the meantime.
+    class FormattingContextTimer {
+        AK_MAKE_NONCOPYABLE(FormattingContextTimer);
+        AK_MAKE_NONMOVABLE(FormattingContextTimer);
+
+    public:
+        FormattingContextTimer(RenderingPhaseTimings* timings, Layout::FormattingContext::Type type)
+            : m_timings(timings)
+        {
+            if (m_timings)
+                m_timings->begin_formatting_context(type);
+        }
+
+        ~FormattingContextTimer()
+        {
+            if (m_timings)
+                m_timings->end_formatting_context();
+        }
+
+    private:
+        RenderingPhaseTimings* m_timings { nullptr };
+    };
+
+    RenderingPhaseTimings() = default;
+
+    void add_time_spent_in_phase(Phase, AK::Duration);
+    void begin_formatting_context(Layout::FormattingContext::Type);
+    void end_formatting_context();
+
+    // Completes the current update. Called once a display list has been recorded.
+    void finish_update();
+
+    // Bounds the memory used by long-lived and animating pages; older updates are only counted.
+    static constexpr size_t max_completed_updates = 600;
+    using CompletedUpdates = CircularQueue<Update, max_completed_updates>;
+
+    // The most recently completed updates, oldest first, and the update in progress.
+    [[nodiscard]] CompletedUpdates const& completed_updates() const { return m_completed_updates; }
+    [[nodiscard]] size_t dropped_updates() const { return m_dropped_updates; }
+    [[nodiscard]] Update const& current_update() const { return m_current_update; }
+
+    [[nodiscard]] String to_json() const;
+
+private:
+    struct RunningFormattingContext {
+        Layout::FormattingContext::Type type;
+        MonotonicTime start;
+        AK::Duration time_spent_in_nested_contexts;
+    };
+
+    CompletedUpdates m_completed_updates;
+    size_t m_dropped_updates { 0 };
+    Update m_current_update;
+    Vector<RunningFormattingContext> m_running_formatting_contexts;
+};
+
+WEB_API void set_enable_rendering_phase_timings(bool enabled);
+bool rendering_phase_timings_enabled();
+
+}
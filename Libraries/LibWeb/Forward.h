@@ -370,6 +370,7 @@ class StringStyleValue;
 class StyleComputer;
 class StylePropertyMap;
 class StylePropertyMapReadOnly;
+class StyleRecalcTrace;
 class StyleScope;
 class StyleSheet;
 class StyleSheetList;
@@ -472,6 +473,7 @@ class ProcessingInstruction;
 class PseudoElement;
 class Range;
 class RegisteredObserver;
+class RenderingPhaseTimings;
 class ShadowRoot;
 class StaticNodeList;
 class StaticRange;
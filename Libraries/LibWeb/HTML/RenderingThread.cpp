@@ -38,6 +38,15 @@ void RenderingThread::start(DisplayListPlayerType display_list_player_type)
 {
     m_display_list_player_type = display_list_player_type;
     VERIFY(m_skia_player);
+    if (display_list_player_type == DisplayListPlayerType::SkiaCPU) {
+        if (auto thread_count = Painting::tile_rasterization_thread_count(); thread_count > 1) {
+            auto tile_rasterizer = Painting::TileRasterizer::create(thread_count);
+            if (tile_rasterizer.is_error())
+                dbgln("Failed to create tile rasterizer, painting on the rendering thread only: {}", tile_rasterizer.error());
+            else
+                m_tile_rasterizer = tile_rasterizer.release_value();
+        }
+    }
     m_thread = Threading::Thread::construct([this] {
         rendering_thread_loop();
         return static_cast<intptr_t>(0);
@@ -68,7 +77,16 @@ void RenderingThread::rendering_thread_loop()
             break;
         }
 
-        m_skia_player->execute(*task->display_list, move(task->scroll_state_snapshot_by_display_list), task->painting_surface);
+        // NOTE: Only the tiles of the surface whose contents changed since it was last painted are repainted. If
+        //       nothing changed at all, the surface is left alone.
+        auto damage = m_tile_damage_tracker.compute_damage(*task->painting_surface, *task->display_list, task->scroll_state_snapshot_by_display_list);
+        if (!damage.is_empty()) {
+            auto painted_on_tile_threads = m_tile_rasterizer
+                && Painting::TileRasterizer::can_rasterize(*task->display_list)
+                && m_tile_rasterizer->rasterize(*task->display_list, task->scroll_state_snapshot_by_display_list, *task->painting_surface, damage);
+            if (!painted_on_tile_threads)
+                m_skia_player->execute_in_rects(*task->display_list, move(task->scroll_state_snapshot_by_display_list), task->painting_surface, damage);
+        }
         if (m_exit)
             break;
         task->callback();
@@ -14,6 +14,8 @@
 #include <LibThreading/Mutex.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/TileDamageTracker.h>
+#include <LibWeb/Painting/TileRasterizer.h>
 
 namespace Web::HTML {
 
@@ -37,6 +39,10 @@ private:
 
     OwnPtr<Painting::DisplayListPlayerSkia> m_skia_player;
 
+    // NOTE: Only used on the rendering thread.
+    Painting::TileDamageTracker m_tile_damage_tracker;
+    OwnPtr<Painting::TileRasterizer> m_tile_rasterizer;
+
     RefPtr<Threading::Thread> m_thread;
     Atomic<bool> m_exit { false };
     NonnullRefPtr<Core::Promise<NonnullRefPtr<Core::EventReceiver>>> m_main_thread_exit_promise;
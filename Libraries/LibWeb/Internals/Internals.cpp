@@ -14,6 +14,7 @@
 #include <LibWeb/Bindings/InternalsPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/DOM/EventTarget.h>
@@ -356,6 +357,39 @@ String Internals::dump_gc_graph()
     return Bindings::main_thread_vm().heap().dump_graph().serialized();
 }
 
+JS::Object* Internals::get_rule_matching_statistics()
+{
+    auto const& statistics = window().associated_document().style_computer().rule_matching_statistics();
+    auto result = JS::Object::create(realm(), nullptr);
+    result->define_direct_property("elements"_utf16_fly_string, JS::Value(static_cast<double>(statistics.elements)), JS::default_attributes);
+    result->define_direct_property("candidateRules"_utf16_fly_string, JS::Value(static_cast<double>(statistics.candidate_rules)), JS::default_attributes);
+    result->define_direct_property("rulesRejectedByAncestorFilter"_utf16_fly_string, JS::Value(static_cast<double>(statistics.rules_rejected_by_ancestor_filter)), JS::default_attributes);
+    result->define_direct_property("rulesTried"_utf16_fly_string, JS::Value(static_cast<double>(statistics.rules_tried)), JS::default_attributes);
+    result->define_direct_property("rulesMatched"_utf16_fly_string, JS::Value(static_cast<double>(statistics.rules_matched)), JS::default_attributes);
+    result->define_direct_property("elementsSharingStyle"_utf16_fly_string, JS::Value(static_cast<double>(statistics.elements_sharing_style)), JS::default_attributes);
+    return result;
+}
+
+void Internals::start_style_recalc_trace()
+{
+    window().associated_document().style_computer().start_style_recalc_trace();
+}
+
+String Internals::stop_style_recalc_trace()
+{
+    return window().associated_document().style_computer().stop_style_recalc_trace();
+}
+
+void Internals::start_recording_rendering_phase_timings()
+{
+    window().associated_document().start_recording_rendering_phase_timings();
+}
+
+String Internals::stop_recording_rendering_phase_timings()
+{
+    return window().associated_document().stop_recording_rendering_phase_timings();
+}
+
 GC::Ptr<DOM::ShadowRoot> Internals::get_shadow_root(GC::Ref<DOM::Element> element)
 {
     return element->shadow_root();
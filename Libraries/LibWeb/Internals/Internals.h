@@ -72,6 +72,14 @@ public:
     String dump_display_list();
     String dump_gc_graph();
 
+    JS::Object* get_rule_matching_statistics();
+
+    void start_style_recalc_trace();
+    String stop_style_recalc_trace();
+
+    void start_recording_rendering_phase_timings();
+    String stop_recording_rendering_phase_timings();
+
     GC::Ptr<DOM::ShadowRoot> get_shadow_root(GC::Ref<DOM::Element>);
 
     void handle_sdl_input_events();
@@ -572,7 +572,7 @@ void BlockFormattingContext::layout_inline_children(BlockContainer const& block_
     auto& block_container_state = m_state.get_mutable(block_container);
 
     InlineFormattingContext context(m_state, m_layout_mode, block_container, block_container_state, *this);
-    context.run(available_space);
+    run_with_timing(context, available_space);
 
     if (!block_container_state.has_definite_width()) {
         // NOTE: min-width or max-width for boxes with inline children can only be applied after inside layout
@@ -836,8 +836,9 @@ void BlockFormattingContext::layout_block_level_box(Box const& box, BlockContain
     }
 
     if (independent_formatting_context) {
-        // This box establishes a new formatting context. Pass control to it.
-        independent_formatting_context->run(box_state.available_inner_space_or_constraints_from(available_space));
+        // This box establishes a new formatting context. Pass control to it, unless its contents were laid out with
+        // the same inputs before and haven't changed since.
+        run_independent_formatting_context(*independent_formatting_context, box_state.available_inner_space_or_constraints_from(available_space));
     } else {
         // This box participates in the current block container's flow.
         if (box.children_are_inline()) {
@@ -1059,7 +1060,7 @@ void BlockFormattingContext::layout_viewport(AvailableSpace const& available_spa
         auto content_height = m_state.get(*svg_root.containing_block()).content_height();
         m_state.get_mutable(svg_root).set_content_height(content_height);
         auto svg_formatting_context = create_independent_formatting_context_if_needed(m_state, m_layout_mode, svg_root);
-        svg_formatting_context->run(available_space);
+        run_with_timing(*svg_formatting_context, available_space);
     } else {
         if (root().children_are_inline())
             layout_inline_children(root(), available_space);
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/RenderingPhaseTimings.h>
 #include <LibWeb/Dump.h>
 #include <LibWeb/Layout/BlockFormattingContext.h>
 #include <LibWeb/Layout/Box.h>
@@ -260,13 +262,31 @@ OwnPtr<FormattingContext> FormattingContext::layout_inside(Box const& child_box,
 
     auto independent_formatting_context = create_independent_formatting_context_if_needed(m_state, layout_mode, child_box);
     if (independent_formatting_context)
-        independent_formatting_context->run(available_space);
+        run_independent_formatting_context(*independent_formatting_context, available_space);
     else
         run(available_space);
 
     return independent_formatting_context;
 }
 
+void FormattingContext::run_independent_formatting_context(FormattingContext& context, AvailableSpace const& available_space)
+{
+    // NOTE: Only block formatting contexts derive everything they tell their parent afterwards from the used values,
+    //       which is what allows us to skip running them. This lets a flex or grid container with many items, or a
+    //       table with many cells, lay out only the ones whose contents or constraints changed.
+    auto can_reuse_previous_layout = context.m_layout_mode == LayoutMode::Normal
+        && context.type() == Type::Block
+        && m_state.try_to_reuse_previous_layout_of_formatting_context_root(context.context_box(), available_space);
+    if (!can_reuse_previous_layout)
+        run_with_timing(context, available_space);
+}
+
+void FormattingContext::run_with_timing(FormattingContext& context, AvailableSpace const& available_space)
+{
+    DOM::RenderingPhaseTimings::FormattingContextTimer timer { context.context_box().document().rendering_phase_timings(), context.type() };
+    context.run(available_space);
+}
+
 CSSPixels FormattingContext::greatest_child_width(Box const& box) const
 {
     CSSPixels max_width = 0;
@@ -480,7 +500,7 @@ CSSPixels FormattingContext::compute_table_box_height_inside_table_wrapper(Box c
 
     auto context = create_independent_formatting_context_if_needed(throwaway_state, LayoutMode::IntrinsicSizing, box);
     VERIFY(context);
-    context->run(m_state.get(box).available_inner_space_or_constraints_from(available_space));
+    run_with_timing(*context, m_state.get(box).available_inner_space_or_constraints_from(available_space));
 
     Optional<Box const&> table_box;
     box.for_each_in_subtree_of_type<Box>([&](Box const& child_box) {
@@ -1475,7 +1495,7 @@ CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box)
         ? AvailableSize::make_definite(box_state.content_height())
         : AvailableSize::make_indefinite();
 
-    context->run(AvailableSpace(available_width, available_height));
+    run_with_timing(*context, AvailableSpace(available_width, available_height));
 
     auto min_content_width = clamp_to_max_dimension_value(context->automatic_content_width());
     cache.emplace(min_content_width);
@@ -1512,7 +1532,7 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
         ? AvailableSize::make_definite(box_state.content_height())
         : AvailableSize::make_indefinite();
 
-    context->run(AvailableSpace(available_width, available_height));
+    run_with_timing(*context, AvailableSpace(available_width, available_height));
 
     auto max_content_width = clamp_to_max_dimension_value(context->automatic_content_width());
     cache.emplace(max_content_width);
@@ -1545,7 +1565,7 @@ CSSPixels FormattingContext::calculate_min_content_height(Layout::Box const& box
 
     auto context = const_cast<FormattingContext*>(this)->create_independent_formatting_context(throwaway_state, LayoutMode::IntrinsicSizing, box);
 
-    context->run(AvailableSpace(AvailableSize::make_definite(width), AvailableSize::make_min_content()));
+    run_with_timing(*context, AvailableSpace(AvailableSize::make_definite(width), AvailableSize::make_min_content()));
 
     auto min_content_height = clamp_to_max_dimension_value(context->automatic_content_height());
     cache.emplace(min_content_height);
@@ -1573,7 +1593,7 @@ CSSPixels FormattingContext::calculate_max_content_height(Layout::Box const& box
 
     auto context = const_cast<FormattingContext*>(this)->create_independent_formatting_context(throwaway_state, LayoutMode::IntrinsicSizing, box);
 
-    context->run(AvailableSpace(AvailableSize::make_definite(width), AvailableSize::make_max_content()));
+    run_with_timing(*context, AvailableSpace(AvailableSize::make_definite(width), AvailableSize::make_max_content()));
 
     auto max_content_height = clamp_to_max_dimension_value(context->automatic_content_height());
     cache_slot.emplace(max_content_height);
@@ -38,6 +38,9 @@ public:
 
     virtual void run(AvailableSpace const&) = 0;
 
+    // Runs the given context, charging the time spent in it to its type if the document records rendering phase timings.
+    static void run_with_timing(FormattingContext&, AvailableSpace const&);
+
     // These functions return the automatic content dimensions of the context's root box.
     virtual CSSPixels automatic_content_width() const = 0;
     virtual CSSPixels automatic_content_height() const = 0;
@@ -110,6 +113,9 @@ protected:
 
     OwnPtr<FormattingContext> layout_inside(Box const&, LayoutMode, AvailableSpace const&);
 
+    // Runs an independent formatting context, unless the contents of its root can be carried over from the previous layout.
+    void run_independent_formatting_context(FormattingContext&, AvailableSpace const&);
+
     struct SpaceUsedByFloats {
         CSSPixels left { 0 };
         CSSPixels right { 0 };
@@ -7,6 +7,7 @@
  */
 
 #include <AK/Debug.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/Layout/AvailableSpace.h>
 #include <LibWeb/Layout/InlineNode.h>
@@ -22,32 +23,170 @@ LayoutState::~LayoutState()
 {
 }
 
-LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyle const& node)
+LayoutState::UsedValues* LayoutState::find_used_values(NodeWithStyle const& node) const
 {
-    if (auto* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
-        return *used_values;
+    auto index = node.layout_index();
+    auto page_index = index / used_values_page_size;
+    if (page_index >= m_used_values_pages.size() || !m_used_values_pages[page_index])
+        return nullptr;
+    auto* used_values = (*m_used_values_pages[page_index])[index % used_values_page_size];
+    VERIFY(!used_values || &used_values->node() == &node);
+    return used_values;
+}
 
+LayoutState::UsedValues& LayoutState::create_used_values(NodeWithStyle const& node)
+{
     auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
 
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(node, containing_block_used_values);
-    used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    m_used_values.append({});
+    auto& used_values = m_used_values[m_used_values.size() - 1];
+    used_values.set_node(node, containing_block_used_values);
+
+    auto index = node.layout_index();
+    auto page_index = index / used_values_page_size;
+    if (page_index >= m_used_values_pages.size())
+        m_used_values_pages.resize(page_index + 1);
+    auto& page = m_used_values_pages[page_index];
+    if (!page) {
+        page = make<UsedValuesPage>();
+        page->fill(nullptr);
+    }
+    (*page)[index % used_values_page_size] = &used_values;
+    return used_values;
+}
+
+LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyle const& node)
+{
+    if (auto* used_values = find_used_values(node))
+        return *used_values;
+    return create_used_values(node);
 }
 
 LayoutState::UsedValues const& LayoutState::get(NodeWithStyle const& node) const
 {
-    if (auto const* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
+    if (auto const* used_values = find_used_values(node))
         return *used_values;
+    return const_cast<LayoutState*>(this)->create_used_values(node);
+}
 
-    auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
+LayoutState::UsedValues const* LayoutState::try_get(NodeWithStyle const& node) const
+{
+    return find_used_values(node);
+}
+
+bool LayoutState::can_reuse_previous_layout_of_formatting_context_root(Box const& root) const
+{
+    // Percentage heights in quirks mode may resolve against boxes outside of the root.
+    if (root.document().in_quirks_mode())
+        return false;
+
+    auto can_reuse = true;
+    root.for_each_in_subtree([&](Node const& node) {
+        // Committing moves the computed SVG paths out of the used values, so there is nothing left to carry over.
+        if (node.is_svg_box() || node.is_svg_svg_box()) {
+            can_reuse = false;
+            return TraversalDecision::Break;
+        }
+
+        // Absolutely positioned boxes whose containing block is outside of the root are positioned by a formatting
+        // context outside of it, relative to where the root ended up.
+        if (auto const* box = as_if<Box>(node); box && box->is_absolutely_positioned()) {
+            auto containing_block = box->containing_block();
+            if (!containing_block || !root.is_inclusive_ancestor_of(*containing_block)) {
+                can_reuse = false;
+                return TraversalDecision::Break;
+            }
+        }
+        return TraversalDecision::Continue;
+    });
+    return can_reuse;
+}
+
+bool LayoutState::try_to_reuse_previous_layout_of_formatting_context_root(Box const& root, AvailableSpace const& available_space)
+{
+    auto const& root_state = get(root);
+    FormattingContextRootInputs inputs {
+        .available_space = available_space,
+        .content_size = { root_state.content_width(), root_state.has_definite_height() ? root_state.content_height() : 0 },
+        .has_definite_width = root_state.has_definite_width(),
+        .has_definite_height = root_state.has_definite_height(),
+    };
+    m_formatting_context_root_inputs.set(root, inputs);
+
+    if (!m_previous_layout_state || root.needs_layout_update())
+        return false;
+
+    // NOTE: Layout nodes that need layout mark all of their ancestors, so a clean root has a clean subtree.
+    auto previous_inputs = m_previous_layout_state->m_formatting_context_root_inputs.get(root);
+    if (!previous_inputs.has_value() || *previous_inputs != inputs)
+        return false;
+
+    if (!can_reuse_previous_layout_of_formatting_context_root(root))
+        return false;
+
+    // Laying out the contents of the root also produced its line boxes, and registered the floats inside it.
+    if (auto const* previous_root_state = m_previous_layout_state->try_get(root)) {
+        auto& mutable_root_state = get_mutable(root);
+        mutable_root_state.line_boxes = previous_root_state->line_boxes;
+        for (auto const& floating_box : previous_root_state->floating_descendants())
+            mutable_root_state.add_floating_descendant(*floating_box);
+    }
+
+    // NOTE: Containing blocks come before the boxes they contain in tree order, so they are always carried over first.
+    root.for_each_in_subtree([&](Node const& node) {
+        // Formatting context roots inside the root can be carried over again by the next layout.
+        if (auto const* box = as_if<Box>(node)) {
+            if (auto nested_root_inputs = m_previous_layout_state->m_formatting_context_root_inputs.get(*box); nested_root_inputs.has_value())
+                m_formatting_context_root_inputs.set(*box, *nested_root_inputs);
+        }
 
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(node, containing_block_used_values);
-    const_cast<LayoutState*>(this)->used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+        auto const* node_with_style = as_if<NodeWithStyle>(node);
+        if (!node_with_style)
+            return TraversalDecision::Continue;
+        if (auto const* previous_used_values = m_previous_layout_state->try_get(*node_with_style))
+            get_mutable(*node_with_style).reuse_values_from(*previous_used_values);
+        return TraversalDecision::Continue;
+    });
+    return true;
+}
+
+OwnPtr<LayoutState> LayoutState::retain_reusable_layouts() const
+{
+    // NOTE: Keeping the whole state around would keep the used values of the entire tree alive until the next layout,
+    //       along with every layout node they refer to, even once those have been removed from the tree.
+    auto retained = make<LayoutState>();
+    for (auto const& [root, inputs] : m_formatting_context_root_inputs) {
+        if (retained->m_formatting_context_root_inputs.contains(root) || !can_reuse_previous_layout_of_formatting_context_root(*root))
+            continue;
+
+        root->for_each_in_inclusive_subtree([&](Node const& node) {
+            if (auto const* box = as_if<Box>(node)) {
+                if (auto nested_root_inputs = m_formatting_context_root_inputs.get(*box); nested_root_inputs.has_value())
+                    retained->m_formatting_context_root_inputs.set(*box, *nested_root_inputs);
+            }
+
+            auto const* node_with_style = as_if<NodeWithStyle>(node);
+            if (!node_with_style)
+                return TraversalDecision::Continue;
+            if (auto const* used_values = try_get(*node_with_style))
+                retained->get_mutable(*node_with_style).reuse_values_from(*used_values);
+            return TraversalDecision::Continue;
+        });
+    }
+
+    if (retained->m_formatting_context_root_inputs.is_empty())
+        return {};
+    return retained;
+}
+
+void LayoutState::visit_edges(GC::Cell::Visitor& visitor) const
+{
+    // NOTE: Keeping the layout nodes alive for as long as we are ensures that a new layout node can never end up at the
+    //       address of one we have used values for.
+    for (auto const& used_values : m_used_values)
+        visitor.visit(used_values.node());
+    for (auto const& it : m_formatting_context_root_inputs)
+        visitor.visit(it.key);
 }
 
 // https://drafts.csswg.org/css-overflow-3/#scrollable-overflow-region
@@ -163,8 +302,7 @@ void LayoutState::resolve_relative_positions()
 {
     // This function resolves relative position offsets of fragments that belong to inline paintables.
     // It runs *after* the paint tree has been constructed, so it modifies paintable node & fragment offsets directly.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         for (auto& paintable : node.paintables()) {
@@ -214,6 +352,9 @@ static void build_paint_tree(Node& node, Painting::Paintable* parent_paintable =
 
 void LayoutState::commit(Box& root)
 {
+    // The previous layout state goes away once this one replaces it, and there is nothing left to carry over anyway.
+    m_previous_layout_state = nullptr;
+
     // Go through the layout tree and detach all paintables. The layout tree should only point to the new paintable tree
     // which we're about to build.
     root.for_each_in_inclusive_subtree([](Node& node) {
@@ -256,7 +397,7 @@ void LayoutState::commit(Box& root)
                 auto& inline_node = const_cast<InlineNode&>(static_cast<InlineNode const&>(*parent));
                 auto line_paintable = inline_node.create_paintable_for_line_with_index(line_index);
                 line_paintable->add_fragment(fragment);
-                if (auto const* used_values = used_values_per_layout_node.get(inline_node).value_or(nullptr))
+                if (auto const* used_values = try_get(inline_node))
                     transfer_box_model_metrics(line_paintable->box_model(), *used_values);
                 if (!inline_node_paintables.contains(line_paintable.ptr())) {
                     inline_node_paintables.set(line_paintable.ptr());
@@ -268,8 +409,7 @@ void LayoutState::commit(Box& root)
         return false;
     };
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = used_values.node();
 
         auto paintable = node.create_paintable();
@@ -324,15 +464,14 @@ void LayoutState::commit(Box& root)
         auto line_paintable = inline_node->create_paintable_for_line_with_index(0);
         inline_node->add_paintable(line_paintable);
         inline_node_paintables.set(line_paintable.ptr());
-        if (auto const* used_values = used_values_per_layout_node.get(*inline_node).value_or(nullptr))
+        if (auto const* used_values = try_get(*inline_node))
             transfer_box_model_metrics(line_paintable->box_model(), *used_values);
     }
 
     // Resolve relative positions for regular boxes (not line box fragments):
     // NOTE: This needs to occur before fragments are transferred into the corresponding inline paintables, because
     //       after this transfer, the containing_line_box_fragment will no longer be valid.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         if (!node.is_box())
@@ -386,16 +525,16 @@ void LayoutState::commit(Box& root)
             if (is<BlockContainer>(paintable.layout_node()))
                 return TraversalDecision::Continue;
 
-            auto used_values = used_values_per_layout_node.get(paintable.layout_node_with_style_and_box_metrics());
-            if (&paintable != paintable_with_lines && used_values.has_value())
-                size.set_width(size.width() + used_values.value()->margin_box_left() + used_values.value()->margin_box_right());
+            auto const* used_values = try_get(paintable.layout_node_with_style_and_box_metrics());
+            if (&paintable != paintable_with_lines && used_values)
+                size.set_width(size.width() + used_values->margin_box_left() + used_values->margin_box_right());
 
             auto const& fragments = paintable.fragments();
             if (!fragments.is_empty()) {
                 if (!offset.has_value() || (fragments.first().offset().x() < offset->x()))
                     offset = fragments.first().offset();
-                if (&paintable == paintable_with_lines->first_child() && used_values.has_value())
-                    offset->translate_by(-used_values.value()->margin_box_left(), 0);
+                if (&paintable == paintable_with_lines->first_child() && used_values)
+                    offset->translate_by(-used_values->margin_box_left(), 0);
             }
             for (auto const& fragment : fragments)
                 size.set_width(size.width() + fragment.width());
@@ -423,8 +562,7 @@ void LayoutState::commit(Box& root)
     }
 
     // Measure overflow in scroll containers.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto const* box = as_if<Box>(used_values.node());
         if (!box)
             continue;
@@ -438,8 +576,7 @@ void LayoutState::commit(Box& root)
             (void)paintable_box.set_scroll_offset(paintable_box.scroll_offset());
     }
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = used_values.node();
         for (auto& paintable : node.paintables()) {
             auto* paintable_box = as_if<Painting::PaintableBox>(paintable);
@@ -629,6 +766,14 @@ void LayoutState::UsedValues::set_content_height(CSSPixels height)
     m_content_height = clamp_to_max_dimension_value(height);
 }
 
+void LayoutState::UsedValues::reuse_values_from(UsedValues const& other)
+{
+    VERIFY(m_node == other.m_node);
+    auto const* containing_block_used_values = m_containing_block_used_values;
+    *this = other;
+    m_containing_block_used_values = containing_block_used_values;
+}
+
 AvailableSize LayoutState::UsedValues::available_width_inside() const
 {
     if (width_constraint == SizeConstraint::MinContent)
@@ -6,9 +6,13 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/HashMap.h>
+#include <AK/SegmentedVector.h>
+#include <LibGC/Cell.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
+#include <LibWeb/Layout/AvailableSpace.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/LineBox.h>
 #include <LibWeb/Painting/PaintableBox.h>
@@ -22,9 +26,6 @@ enum class SizeConstraint {
     MaxContent,
 };
 
-class AvailableSize;
-class AvailableSpace;
-
 // https://www.w3.org/TR/css-position-3/#static-position-rectangle
 struct StaticPositionRect {
     enum class Alignment {
@@ -133,6 +134,10 @@ struct LayoutState {
 
         Optional<LineBoxFragmentCoordinate> containing_line_box_fragment;
 
+        // Takes over everything from the used values of the same node in another layout state, while staying linked
+        // to the containing block's used values in this one.
+        void reuse_values_from(UsedValues const&);
+
         void add_floating_descendant(Box const& box) { m_floating_descendants.set(&box); }
         auto const& floating_descendants() const { return m_floating_descendants; }
 
@@ -196,18 +201,65 @@ struct LayoutState {
         Optional<StaticPositionRect> m_static_position_rect;
     };
 
+    LayoutState() = default;
+
+    // The state of the previous layout of the same document, whose used values may be carried over for formatting
+    // context roots that don't need to be laid out again.
+    explicit LayoutState(LayoutState const* previous_layout_state)
+        : m_previous_layout_state(previous_layout_state)
+    {
+    }
+
     ~LayoutState();
 
+    // Everything the contents of a formatting context root depend on from outside of it.
+    struct FormattingContextRootInputs {
+        AvailableSpace available_space;
+        CSSPixelSize content_size;
+        bool has_definite_width { false };
+        bool has_definite_height { false };
+
+        bool operator==(FormattingContextRootInputs const&) const = default;
+    };
+
+    // Records the inputs the contents of `root` are about to be laid out with. If the previous layout laid them out
+    // with the same inputs and nothing inside `root` needs layout since, the used values produced back then are
+    // carried over into this state and true is returned, meaning the contents of `root` don't need to be laid out.
+    [[nodiscard]] bool try_to_reuse_previous_layout_of_formatting_context_root(Box const& root, AvailableSpace const&);
+
+    void visit_edges(GC::Cell::Visitor&) const;
+
     // Commits the used values produced by layout and builds a paintable tree.
     void commit(Box& root);
 
+    // Returns a state holding only what the next layout may carry over from this one: the inputs and used values of
+    // the formatting context roots that can be reused, or null if there are none.
+    [[nodiscard]] OwnPtr<LayoutState> retain_reusable_layouts() const;
+
     UsedValues& get_mutable(NodeWithStyle const&);
     UsedValues const& get(NodeWithStyle const&) const;
 
-    OrderedHashMap<GC::Ref<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
+    // Returns the used values of the node, or nullptr if they haven't been created in this state.
+    UsedValues const* try_get(NodeWithStyle const&) const;
 
 private:
     void resolve_relative_positions();
+
+    UsedValues* find_used_values(NodeWithStyle const&) const;
+    UsedValues& create_used_values(NodeWithStyle const&);
+
+    // Used values are allocated in chunks, in the order they are created, and never move. They are found through a
+    // table indexed by the layout index of their node, which is split into pages so that the throwaway states used for
+    // intrinsic sizing only pay for the few parts of the tree they touch.
+    static constexpr size_t used_values_page_size = 64;
+    using UsedValuesPage = Array<UsedValues*, used_values_page_size>;
+    SegmentedVector<UsedValues, 64> m_used_values;
+    Vector<OwnPtr<UsedValuesPage>> m_used_values_pages;
+
+    bool can_reuse_previous_layout_of_formatting_context_root(Box const& root) const;
+
+    LayoutState const* m_previous_layout_state { nullptr };
+    HashMap<GC::Ref<Box const>, FormattingContextRootInputs> m_formatting_context_root_inputs;
 };
 
 inline CSSPixels clamp_to_max_dimension_value(CSSPixels value)
@@ -7,6 +7,7 @@
  */
 
 #include <AK/Demangle.h>
+#include <AK/NeverDestroyed.h>
 #include <LibWeb/CSS/ComputedProperties.h>
 #include <LibWeb/CSS/StyleValues/AbstractImageStyleValue.h>
 #include <LibWeb/CSS/StyleValues/BackgroundSizeStyleValue.h>
@@ -38,15 +39,29 @@
 
 namespace Web::Layout {
 
+static NeverDestroyed<Vector<u32>> s_free_layout_indices;
+static u32 s_next_layout_index = 0;
+
+static u32 allocate_layout_index()
+{
+    if (!s_free_layout_indices->is_empty())
+        return s_free_layout_indices->take_last();
+    return s_next_layout_index++;
+}
+
 Node::Node(DOM::Document& document, DOM::Node* node)
     : m_dom_node(node ? *node : document)
+    , m_layout_index(allocate_layout_index())
     , m_anonymous(node == nullptr)
 {
     if (node)
         node->set_layout_node({}, *this);
 }
 
-Node::~Node() = default;
+Node::~Node()
+{
+    s_free_layout_indices->append(m_layout_index);
+}
 
 void Node::visit_edges(Cell::Visitor& visitor)
 {
@@ -46,6 +46,10 @@ public:
     DOM::Element const* pseudo_element_generator() const;
     DOM::Element* pseudo_element_generator();
 
+    // Unique among the layout nodes alive at the same time, and reused after a node is destroyed, which keeps these
+    // small enough to index dense tables with.
+    u32 layout_index() const { return m_layout_index; }
+
     bool needs_layout_update() const { return m_needs_layout_update; }
     void set_needs_layout_update(DOM::SetNeedsLayoutReason);
     void reset_needs_layout_update() { m_needs_layout_update = false; }
@@ -221,6 +225,8 @@ private:
 
     GC::Ptr<DOM::Element> m_pseudo_element_generator;
 
+    u32 m_layout_index { 0 };
+
     bool m_anonymous { false };
     bool m_has_style { false };
     bool m_children_are_inline { false };
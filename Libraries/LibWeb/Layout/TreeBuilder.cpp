@@ -553,6 +553,64 @@ static bool is_ignorable_whitespace(Layout::Node const& node)
     return false;
 }
 
+// When an ancestor's box is recreated, a clean block-level descendant can keep its box and everything below it, and
+// just be moved over into the new tree. This avoids recreating (and relaying out) the whole subtree when e.g. an inline
+// child of a large block container changes display.
+bool TreeBuilder::reuse_layout_subtree_if_possible(DOM::Node& dom_node, Context const& context)
+{
+    auto* element = as_if<DOM::Element>(dom_node);
+    if (!element || element->needs_layout_tree_update() || element->child_needs_layout_tree_update())
+        return false;
+    if (element->document().needs_full_layout_tree_update())
+        return false;
+    if (context.has_svg_root || context.layout_top_layer || context.layout_svg_mask_or_clip_path || element->rendered_in_top_layer())
+        return false;
+
+    auto layout_node = element->layout_node();
+    if (!layout_node || !layout_node->is_box() || layout_node->is_svg_box())
+        return false;
+
+    // Only block-level boxes are self-contained: inline-level boxes may have been split into continuations, and
+    // table-internal boxes depend on the anonymous table structure around them. Table roots sit inside an anonymous
+    // table wrapper that only gets generated along with them.
+    auto display = layout_node->display();
+    if (!display.is_block_outside() || display.is_list_item() || display != element->computed_properties()->display())
+        return false;
+    if (display.is_table_inside() || layout_node->has_been_wrapped_in_table_wrapper())
+        return false;
+
+    // Generated content may depend on counters and quotes from earlier in the document, which may have changed.
+    bool has_generated_content = false;
+    layout_node->for_each_in_inclusive_subtree([&](Layout::Node const& node) {
+        if (node.is_generated_for_pseudo_element() || node.is_list_item_box()) {
+            has_generated_content = true;
+            return TraversalDecision::Break;
+        }
+        return TraversalDecision::Continue;
+    });
+    if (has_generated_content)
+        return false;
+
+    // Counters set in the subtree still have to be resolved again, since elements after it inherit them.
+    layout_node->for_each_in_inclusive_subtree([&](Layout::Node& node) {
+        if (auto* descendant = as_if<DOM::Element>(node.dom_node()); descendant && descendant->layout_node() == &node) {
+            DOM::AbstractElement element_reference { *descendant };
+            CSS::resolve_counters(element_reference);
+        }
+        return TraversalDecision::Continue;
+    });
+
+    if (layout_node->parent())
+        layout_node->remove();
+    insert_node_into_inline_or_block_ancestor(*layout_node, display, AppendOrPrepend::Append);
+
+    if (auto node_with_metrics = as_if<NodeWithStyleAndBoxModelMetrics>(*layout_node);
+        node_with_metrics && node_with_metrics->should_create_inline_continuation())
+        restructure_block_node_in_inline_parent(*node_with_metrics);
+
+    return true;
+}
+
 void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context& context, MustCreateSubtree must_create_subtree)
 {
     bool should_create_layout_node = must_create_subtree == MustCreateSubtree::Yes
@@ -565,6 +623,8 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
         if (element.rendered_in_top_layer() && !context.layout_top_layer)
             return;
     }
+    if (must_create_subtree == MustCreateSubtree::Yes && reuse_layout_subtree_if_possible(dom_node, context))
+        return;
     if (dom_node.is_element())
         dom_node.document().style_computer().push_ancestor(static_cast<DOM::Element const&>(dom_node));
 
@@ -864,7 +924,7 @@ GC::Ptr<Layout::Node> TreeBuilder::build(DOM::Node& dom_node)
 {
     VERIFY(dom_node.is_document());
 
-    dom_node.document().style_computer().reset_ancestor_filter();
+    CSS::StyleComputer::TraversalScope traversal_scope { dom_node.document().style_computer(), dom_node };
 
     Context context;
     m_quote_nesting_level = 0;
@@ -15,6 +15,11 @@ void DisplayList::append(DisplayListCommand&& command, Optional<i32> scroll_fram
     m_commands.append({ scroll_frame_id, clip_frame, move(command) });
 }
 
+void DisplayList::finalize(Badge<DisplayListRecorder>)
+{
+    m_spatial_index = DisplayListSpatialIndex::create(*this);
+}
+
 String DisplayList::dump() const
 {
     StringBuilder builder;
@@ -68,6 +73,8 @@ static bool command_is_clip_or_mask(DisplayListCommand const& command)
 
 void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface)
 {
+    ++m_replay_generation;
+
     TemporaryChange change { m_scroll_state_snapshots_by_display_list, move(scroll_state_snapshot_by_display_list) };
     if (surface) {
         surface->lock_context();
@@ -79,6 +86,50 @@ void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotBy
     }
 }
 
+void DisplayListPlayer::execute_in_rects(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, NonnullRefPtr<Gfx::PaintingSurface> surface, ReadonlySpan<Gfx::IntRect> rects)
+{
+    ++m_replay_generation;
+
+    TemporaryChange change { m_scroll_state_snapshots_by_display_list, move(scroll_state_snapshot_by_display_list) };
+    surface->lock_context();
+    m_surfaces.append(surface);
+    auto scroll_state_snapshot = m_scroll_state_snapshots_by_display_list.get(display_list).value_or({});
+
+    // NOTE: The display list is replayed once per rect. Commands outside of the rect being painted are skipped by the
+    //       clipping check in execute_impl(), so this only costs a walk over the commands per rect.
+    for (auto const& rect : rects) {
+        save({});
+        add_clip_rect({ .rect = rect });
+        execute_impl(display_list, scroll_state_snapshot, {});
+        restore({});
+    }
+
+    flush();
+    (void)m_surfaces.take_last();
+    surface->unlock_context();
+}
+
+void DisplayListPlayer::execute_tile(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, NonnullRefPtr<Gfx::PaintingSurface> surface, Gfx::IntRect const& tile_rect)
+{
+    VERIFY(surface->size() == tile_rect.size());
+    ++m_replay_generation;
+
+    TemporaryChange change { m_scroll_state_snapshots_by_display_list, move(scroll_state_snapshot_by_display_list) };
+    surface->lock_context();
+    m_surfaces.append(surface);
+    auto scroll_state_snapshot = m_scroll_state_snapshots_by_display_list.get(display_list).value_or({});
+
+    save({});
+    translate({ .delta = { -tile_rect.x(), -tile_rect.y() } });
+    add_clip_rect({ .rect = tile_rect });
+    execute_impl(display_list, scroll_state_snapshot, {});
+    restore({});
+
+    flush();
+    (void)m_surfaces.take_last();
+    surface->unlock_context();
+}
+
 void DisplayListPlayer::apply_clip_frame(ClipFrame const& clip_frame, ScrollStateSnapshot const& scroll_state, DevicePixelConverter const& device_pixel_converter)
 {
     auto const& clip_rects = clip_frame.clip_rects();
@@ -110,6 +161,11 @@ void DisplayListPlayer::remove_clip_frame(ClipFrame const& clip_frame)
 }
 
 void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface)
+{
+    execute_impl(display_list, scroll_state, move(surface), 0, display_list.commands().size());
+}
+
+void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface, size_t start_command_index, size_t end_command_index)
 {
     if (surface)
         m_surfaces.append(*surface);
@@ -150,9 +206,44 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         return bounding_rect;
     };
 
+    // Runs of commands that only paint are looked up in the display list's spatial index, if it has one, and only the
+    // commands of a run that may be visible are visited.
+    auto const* spatial_index = display_list.spatial_index();
+    auto runs = spatial_index ? spatial_index->runs() : ReadonlySpan<DisplayListSpatialIndex::Run> {};
+    size_t next_run_index = 0;
+    size_t end_of_run = 0;
+    Vector<size_t> visible_command_indices_in_run;
+    auto next_command_index = [&](size_t command_index) -> size_t {
+        if (command_index + 1 < end_of_run)
+            return visible_command_indices_in_run.is_empty() ? end_of_run : visible_command_indices_in_run.take_last();
+        return command_index + 1;
+    };
+
     Vector<RefPtr<ClipFrame const>> clip_frames_stack;
     clip_frames_stack.append({});
-    for (size_t command_index = 0; command_index < commands.size(); command_index++) {
+    for (size_t command_index = start_command_index; command_index < end_command_index; command_index = next_command_index(command_index)) {
+        if (spatial_index && command_index >= end_of_run) {
+            while (next_run_index < runs.size() && runs[next_run_index].start < command_index)
+                ++next_run_index;
+            if (next_run_index < runs.size() && runs[next_run_index].start == command_index) {
+                auto const& run = runs[next_run_index];
+
+                // NOTE: The clip frame left applied by the command before the run is removed first, so that the clip
+                //       bounds cover every command in the run. Each command applies its own clip frame again.
+                if (auto clip_frame = clip_frames_stack.take_last())
+                    remove_clip_frame(*clip_frame);
+                clip_frames_stack.append({});
+
+                end_of_run = run.end;
+                spatial_index->find_commands_intersecting(run, local_clip_bounds(), scroll_state, device_pixels_per_css_pixel, visible_command_indices_in_run);
+                if (visible_command_indices_in_run.is_empty()) {
+                    command_index = end_of_run - 1;
+                    continue;
+                }
+                command_index = visible_command_indices_in_run.take_last();
+            }
+        }
+
         auto [scroll_frame_id, clip_frame, command] = commands[command_index];
 
         if (clip_frames_stack.last() != clip_frame) {
@@ -220,6 +311,15 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
             continue;
         }
 
+        if (command.has<PushStackingContext>()) {
+            auto const& push_stacking_context = command.get<PushStackingContext>();
+            if (paint_stacking_context_from_cache(display_list, scroll_state, command_index, push_stacking_context)) {
+                command_index = push_stacking_context.matching_pop_index;
+                (void)clip_frames_stack.take_last();
+                continue;
+            }
+        }
+
 #define HANDLE_COMMAND(command_type, executor_method) \
     if (command.has<command_type>()) {                \
         executor_method(command.get<command_type>()); \
@@ -18,6 +18,7 @@
 #include <LibWeb/Forward.h>
 #include <LibWeb/Painting/ClipFrame.h>
 #include <LibWeb/Painting/DisplayListCommand.h>
+#include <LibWeb/Painting/DisplayListSpatialIndex.h>
 #include <LibWeb/Painting/ScrollState.h>
 
 namespace Web::Painting {
@@ -28,10 +29,25 @@ public:
 
     void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>);
 
+    // Repaints only the given rects of the surface, leaving the rest of it as it was.
+    void execute_in_rects(DisplayList&, ScrollStateSnapshotByDisplayList&&, NonnullRefPtr<Gfx::PaintingSurface>, ReadonlySpan<Gfx::IntRect>);
+
+    // Paints the given rect of the display list into a surface of the same size, e.g. a view of one tile of a larger
+    // surface.
+    void execute_tile(DisplayList&, ScrollStateSnapshotByDisplayList&&, NonnullRefPtr<Gfx::PaintingSurface>, Gfx::IntRect const& tile_rect);
+
 protected:
     Gfx::PaintingSurface& surface() const { return m_surfaces.last(); }
+
+    // Changes every time one of the execute functions above is called, e.g. to tell whether something has already been
+    // computed for the current replay.
+    u64 replay_generation() const { return m_replay_generation; }
+
     void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>);
 
+    // Only plays the commands in [start_command_index, end_command_index), e.g. the contents of a stacking context.
+    void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>, size_t start_command_index, size_t end_command_index);
+
     ScrollStateSnapshotByDisplayList m_scroll_state_snapshots_by_display_list;
 
 private:
@@ -71,12 +87,19 @@ private:
     virtual void apply_filter(ApplyFilter const&) = 0;
     virtual void apply_transform(ApplyTransform const&) = 0;
     virtual void apply_mask_bitmap(ApplyMaskBitmap const&) = 0;
+
+    // Paints a stacking context, including everything up to its matching PopStackingContext, from an earlier
+    // rasterization of its contents if there is one that can be reused. Returns false if it has to be painted normally.
+    virtual bool paint_stacking_context_from_cache(DisplayList&, ScrollStateSnapshot const&, size_t push_stacking_context_index, PushStackingContext const&) = 0;
+
     virtual bool would_be_fully_clipped_by_painter(Gfx::IntRect) const = 0;
+    virtual Gfx::IntRect local_clip_bounds() const = 0;
 
     void apply_clip_frame(ClipFrame const&, ScrollStateSnapshot const&, DevicePixelConverter const&);
     void remove_clip_frame(ClipFrame const&);
 
     Vector<NonnullRefPtr<Gfx::PaintingSurface>, 1> m_surfaces;
+    u64 m_replay_generation { 0 };
 };
 
 class DisplayList : public AtomicRefCounted<DisplayList> {
@@ -88,6 +111,9 @@ public:
 
     void append(DisplayListCommand&& command, Optional<i32> scroll_frame_id, RefPtr<ClipFrame const>);
 
+    // Called once all commands have been recorded.
+    void finalize(Badge<DisplayListRecorder>);
+
     struct DisplayListCommandWithScrollAndClip {
         Optional<i32> scroll_frame_id;
         RefPtr<ClipFrame const> clip_frame;
@@ -97,6 +123,7 @@ public:
     auto& commands(Badge<DisplayListRecorder>) { return m_commands; }
     auto const& commands() const { return m_commands; }
     double device_pixels_per_css_pixel() const { return m_device_pixels_per_css_pixel; }
+    DisplayListSpatialIndex const* spatial_index() const { return m_spatial_index.ptr(); }
 
     String dump() const;
 
@@ -120,6 +147,7 @@ private:
 
     AK::SegmentedVector<DisplayListCommandWithScrollAndClip, 512> m_commands;
     double m_device_pixels_per_css_pixel;
+    OwnPtr<DisplayListSpatialIndex> m_spatial_index;
     Optional<Gfx::FloatMatrix4x4> m_visual_viewport_transform;
 };
 
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Painting/DisplayListCommandFingerprint.h>
+
+namespace Web::Painting {
+
+Optional<u64> fingerprint_for_command(DisplayListCommand const& command)
+{
+    Fingerprint fingerprint;
+    fingerprint.add(command.index());
+    auto can_be_fingerprinted = command.visit(
+        [&](DrawGlyphRun const& command) {
+            fingerprint.add(command.glyph_run.ptr());
+            fingerprint.add(command.scale);
+            fingerprint.add(command.rect);
+            fingerprint.add(command.translation);
+            fingerprint.add(command.color);
+            fingerprint.add(command.orientation);
+            return true;
+        },
+        [&](FillRect const& command) {
+            fingerprint.add(command.rect);
+            fingerprint.add(command.color);
+            return true;
+        },
+        [&](DrawScaledImmutableBitmap const& command) {
+            fingerprint.add(command.dst_rect);
+            fingerprint.add(command.clip_rect);
+            fingerprint.add(command.bitmap.ptr());
+            fingerprint.add(command.scaling_mode);
+            return true;
+        },
+        [&](DrawRepeatedImmutableBitmap const& command) {
+            fingerprint.add(command.dst_rect);
+            fingerprint.add(command.clip_rect);
+            fingerprint.add(command.bitmap.ptr());
+            fingerprint.add(command.scaling_mode);
+            fingerprint.add(command.repeat.x);
+            fingerprint.add(command.repeat.y);
+            return true;
+        },
+        [&](OneOf<Save, SaveLayer, Restore, PopStackingContext> auto const&) {
+            return true;
+        },
+        [&](Translate const& command) {
+            fingerprint.add(command.delta);
+            return true;
+        },
+        [&](AddClipRect const& command) {
+            fingerprint.add(command.rect);
+            return true;
+        },
+        [&](PushStackingContext const& command) {
+            if (command.clip_path.has_value())
+                return false;
+            fingerprint.add(command.opacity);
+            fingerprint.add(command.compositing_and_blending_operator);
+            fingerprint.add(command.isolate);
+            fingerprint.add(command.transform.origin);
+            fingerprint.add(command.transform.matrix);
+            fingerprint.add(command.transform.parent_perspective_matrix.has_value());
+            if (command.transform.parent_perspective_matrix.has_value())
+                fingerprint.add(command.transform.parent_perspective_matrix.value());
+            fingerprint.add(command.can_aggregate_children_bounds);
+            return true;
+        },
+        [&](PaintLinearGradient const& command) {
+            fingerprint.add(command.gradient_rect);
+            fingerprint.add(command.linear_gradient_data.gradient_angle);
+            fingerprint.add(command.linear_gradient_data.color_stops);
+            fingerprint.add(command.linear_gradient_data.interpolation_method);
+            return true;
+        },
+        [&](PaintRadialGradient const& command) {
+            fingerprint.add(command.rect);
+            fingerprint.add(command.radial_gradient_data.color_stops);
+            fingerprint.add(command.radial_gradient_data.interpolation_method);
+            fingerprint.add(command.center);
+            fingerprint.add(command.size.width());
+            fingerprint.add(command.size.height());
+            return true;
+        },
+        [&](PaintConicGradient const& command) {
+            fingerprint.add(command.rect);
+            fingerprint.add(command.conic_gradient_data.start_angle);
+            fingerprint.add(command.conic_gradient_data.color_stops);
+            fingerprint.add(command.conic_gradient_data.interpolation_method);
+            fingerprint.add(command.position);
+            return true;
+        },
+        [&](OneOf<PaintOuterBoxShadow, PaintInnerBoxShadow> auto const& command) {
+            fingerprint.add(command.box_shadow_params);
+            return true;
+        },
+        [&](PaintTextShadow const& command) {
+            fingerprint.add(command.glyph_run.ptr());
+            fingerprint.add(command.glyph_run_scale);
+            fingerprint.add(command.shadow_bounding_rect);
+            fingerprint.add(command.text_rect);
+            fingerprint.add(command.draw_location);
+            fingerprint.add(command.blur_radius);
+            fingerprint.add(command.color);
+            return true;
+        },
+        [&](FillRectWithRoundedCorners const& command) {
+            fingerprint.add(command.rect);
+            fingerprint.add(command.color);
+            fingerprint.add(command.corner_radii);
+            return true;
+        },
+        [&](DrawEllipse const& command) {
+            fingerprint.add(command.rect);
+            fingerprint.add(command.color);
+            fingerprint.add(command.thickness);
+            return true;
+        },
+        [&](FillEllipse const& command) {
+            fingerprint.add(command.rect);
+            fingerprint.add(command.color);
+            return true;
+        },
+        [&](DrawLine const& command) {
+            fingerprint.add(command.color);
+            fingerprint.add(command.from);
+            fingerprint.add(command.to);
+            fingerprint.add(command.thickness);
+            fingerprint.add(command.style);
+            fingerprint.add(command.alternate_color);
+            return true;
+        },
+        [&](DrawRect const& command) {
+            fingerprint.add(command.rect);
+            fingerprint.add(command.color);
+            fingerprint.add(command.rough);
+            return true;
+        },
+        [&](AddRoundedRectClip const& command) {
+            fingerprint.add(command.corner_radii);
+            fingerprint.add(command.border_rect);
+            fingerprint.add(command.corner_clip);
+            return true;
+        },
+        [&](AddMask const& command) {
+            // NOTE: Mask display lists are recorded once and never change afterwards.
+            fingerprint.add(command.display_list.ptr());
+            fingerprint.add(command.rect);
+            return true;
+        },
+        [&](PaintScrollBar const& command) {
+            fingerprint.add(command.scroll_frame_id);
+            fingerprint.add(command.gutter_rect);
+            fingerprint.add(command.thumb_rect);
+            fingerprint.add(command.thumb_color);
+            fingerprint.add(command.track_color);
+            fingerprint.add(command.vertical);
+            return true;
+        },
+        [&](ApplyOpacity const& command) {
+            fingerprint.add(command.opacity);
+            return true;
+        },
+        [&](ApplyCompositeAndBlendingOperator const& command) {
+            fingerprint.add(command.compositing_and_blending_operator);
+            return true;
+        },
+        [&](ApplyTransform const& command) {
+            fingerprint.add(command.origin);
+            fingerprint.add(command.matrix);
+            return true;
+        },
+        [&](ApplyMaskBitmap const& command) {
+            fingerprint.add(command.origin);
+            fingerprint.add(command.bitmap.ptr());
+            fingerprint.add(command.kind);
+            return true;
+        },
+        // Painting surfaces (i.e. canvases) and nested display lists change without their commands changing, and
+        // paths and filters aren't worth comparing, so these are assumed to be different on every frame.
+        [&](OneOf<DrawPaintingSurface, FillPath, StrokePath, ApplyBackdropFilter, PaintNestedDisplayList, ApplyFilter> auto const&) {
+            return false;
+        });
+
+    if (!can_be_fingerprinted)
+        return {};
+    return fingerprint.value();
+}
+
+}
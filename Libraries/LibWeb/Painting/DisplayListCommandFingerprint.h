@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BitCast.h>
+#include <AK/Concepts.h>
+#include <AK/Math.h>
+#include <AK/Optional.h>
+#include <AK/StdLibExtras.h>
+#include <LibWeb/Painting/DisplayListCommand.h>
+
+namespace Web::Painting {
+
+inline u64 combine_fingerprints(u64 fingerprint, u64 value)
+{
+    return fingerprint ^ (value + 0x9e3779b97f4a7c15ull + (fingerprint << 6) + (fingerprint >> 2));
+}
+
+// Accumulates everything that affects the pixels some display list commands paint into a single value. Equal
+// fingerprints mean the commands paint the same thing, barring collisions.
+class Fingerprint {
+public:
+    explicit Fingerprint(u64 seed = 0)
+        : m_value(seed)
+    {
+    }
+
+    u64 value() const { return m_value; }
+
+    template<Integral T>
+    void add(T value) { m_value = combine_fingerprints(m_value, static_cast<u64>(value)); }
+
+    template<Enum T>
+    void add(T value) { add(to_underlying(value)); }
+
+    void add(bool value) { add(value ? 1u : 0u); }
+    void add(float value) { add(bit_cast<u32>(value)); }
+    void add(double value) { add(bit_cast<u64>(value)); }
+    void add(void const* pointer) { add(bit_cast<FlatPtr>(pointer)); }
+    void add(Color color) { add(color.value()); }
+
+    template<typename T>
+    void add(Gfx::Point<T> const& point)
+    {
+        add(point.x());
+        add(point.y());
+    }
+
+    void add(Gfx::IntRect const& rect)
+    {
+        add(rect.location());
+        add(rect.width());
+        add(rect.height());
+    }
+
+    void add(CornerRadii const& corner_radii)
+    {
+        for (auto const& corner_radius : { corner_radii.top_left, corner_radii.top_right, corner_radii.bottom_right, corner_radii.bottom_left }) {
+            add(corner_radius.horizontal_radius);
+            add(corner_radius.vertical_radius);
+        }
+    }
+
+    void add(Gfx::FloatMatrix4x4 const& matrix)
+    {
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = 0; j < 4; ++j)
+                add(matrix[i, j]);
+        }
+    }
+
+    void add(ColorStopData const& color_stops)
+    {
+        add(color_stops.list.size());
+        for (auto const& color_stop : color_stops.list) {
+            add(color_stop.color);
+            add(color_stop.position);
+            add(color_stop.transition_hint.value_or(AK::NaN<float>));
+        }
+        add(color_stops.repeat_length.value_or(AK::NaN<float>));
+    }
+
+    void add(CSS::InterpolationMethod const& interpolation_method)
+    {
+        add(interpolation_method.color_space);
+        add(interpolation_method.hue_method);
+    }
+
+    void add(PaintBoxShadowParams const& params)
+    {
+        add(params.color);
+        add(params.placement);
+        add(params.corner_radii);
+        add(params.offset_x);
+        add(params.offset_y);
+        add(params.blur_radius);
+        add(params.spread_distance);
+        add(params.device_content_rect);
+    }
+
+private:
+    u64 m_value { 0 };
+};
+
+// Returns a fingerprint of everything about a command that affects the pixels it paints, or nothing if the command
+// may paint something different without changing.
+Optional<u64> fingerprint_for_command(DisplayListCommand const&);
+
+}
@@ -27,6 +27,8 @@
 #include <LibGfx/PathSkia.h>
 #include <LibGfx/SkiaUtils.h>
 #include <LibWeb/CSS/ComputedValues.h>
+#include <LibWeb/Painting/DevicePixelConverter.h>
+#include <LibWeb/Painting/DisplayListCommandFingerprint.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
 #include <LibWeb/Painting/ShadowPainting.h>
 
@@ -223,16 +225,20 @@ void DisplayListPlayerSkia::translate(Translate const& command)
     canvas.translate(command.delta.x(), command.delta.y());
 }
 
+static SkM44 to_skia_matrix4x4(StackingContextTransform const& transform)
+{
+    auto new_transform = Gfx::translation_matrix(Vector3<float>(transform.origin.x(), transform.origin.y(), 0));
+    new_transform = new_transform * transform.matrix;
+    new_transform = new_transform * Gfx::translation_matrix(Vector3<float>(-transform.origin.x(), -transform.origin.y(), 0));
+    if (transform.parent_perspective_matrix.has_value())
+        new_transform = transform.parent_perspective_matrix.value() * new_transform;
+    return to_skia_matrix4x4(new_transform);
+}
+
 void DisplayListPlayerSkia::push_stacking_context(PushStackingContext const& command)
 {
     auto& canvas = surface().canvas();
-
-    auto new_transform = Gfx::translation_matrix(Vector3<float>(command.transform.origin.x(), command.transform.origin.y(), 0));
-    new_transform = new_transform * command.transform.matrix;
-    new_transform = new_transform * Gfx::translation_matrix(Vector3<float>(-command.transform.origin.x(), -command.transform.origin.y(), 0));
-    if (command.transform.parent_perspective_matrix.has_value())
-        new_transform = command.transform.parent_perspective_matrix.value() * new_transform;
-    auto matrix = to_skia_matrix4x4(new_transform);
+    auto matrix = to_skia_matrix4x4(command.transform);
 
     surface().canvas().save();
     if (command.clip_path.has_value())
@@ -265,6 +271,187 @@ void DisplayListPlayerSkia::pop_stacking_context(PopStackingContext const&)
     surface().canvas().restore();
 }
 
+// NOTE: Layers are only worth keeping around for stacking contexts that are being animated, so the least recently used
+//       ones are dropped once there are too many of them or they take up too much memory.
+static constexpr size_t max_cached_layers = 256;
+static constexpr size_t max_cached_layers_size_in_bytes = 64 * MiB;
+static constexpr i64 max_cached_layer_pixels = 4096 * 4096;
+
+// Returns a fingerprint of everything that affects how the contents of a stacking context look before its own
+// transform, opacity and such are applied, or nothing if they may look different without the display list changing.
+static Optional<u64> fingerprint_for_stacking_context_contents(DisplayList const& display_list, ScrollStateSnapshot const& scroll_state, size_t push_stacking_context_index, PushStackingContext const& command)
+{
+    auto const& commands = display_list.commands();
+    auto device_pixels_per_css_pixel = display_list.device_pixels_per_css_pixel();
+    DevicePixelConverter device_pixel_converter { device_pixels_per_css_pixel };
+
+    Fingerprint fingerprint;
+    fingerprint.add(command.bounding_rect.value());
+    fingerprint.add(device_pixels_per_css_pixel);
+
+    ClipFrame const* last_clip_frame = nullptr;
+    u64 last_clip_frame_fingerprint = 0;
+    for (auto command_index = push_stacking_context_index + 1; command_index < command.matching_pop_index; ++command_index) {
+        auto const& [scroll_frame_id, clip_frame, content_command] = commands[command_index];
+
+        auto command_fingerprint = fingerprint_for_command(content_command);
+        if (!command_fingerprint.has_value())
+            return {};
+        fingerprint.add(command_fingerprint.value());
+
+        // NOTE: This mirrors how execute_impl() moves commands by the offset of their scroll frame.
+        fingerprint.add(scroll_frame_id.has_value());
+        if (scroll_frame_id.has_value()) {
+            auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id.value());
+            fingerprint.add(cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>());
+        }
+        if (auto const* paint_scroll_bar = content_command.get_pointer<PaintScrollBar>())
+            fingerprint.add(scroll_state.own_offset_for_frame_with_id(paint_scroll_bar->scroll_frame_id).to_type<double>());
+
+        // NOTE: This mirrors how DisplayListPlayer::apply_clip_frame() turns clip rects into device pixels.
+        if (clip_frame.ptr() != last_clip_frame) {
+            last_clip_frame = clip_frame.ptr();
+            Fingerprint clip_frame_fingerprint;
+            if (clip_frame) {
+                for (auto const& clip_rect : clip_frame->clip_rects()) {
+                    auto css_rect = clip_rect.rect;
+                    if (auto enclosing_scroll_frame_id = clip_rect.enclosing_scroll_frame_id; enclosing_scroll_frame_id.has_value())
+                        css_rect.translate_by(scroll_state.cumulative_offset_for_frame_with_id(enclosing_scroll_frame_id.value()));
+                    clip_frame_fingerprint.add(device_pixel_converter.rounded_device_rect(css_rect).to_type<int>());
+                    clip_frame_fingerprint.add(clip_rect.corner_radii.as_corners(device_pixel_converter));
+                }
+            }
+            last_clip_frame_fingerprint = clip_frame_fingerprint.value();
+        }
+        fingerprint.add(last_clip_frame_fingerprint);
+    }
+    return fingerprint.value();
+}
+
+// Stacking contexts whose transform or opacity is animating are re-recorded on every frame with contents that don't
+// change. To avoid rasterizing those contents over and over again, they are rasterized into a layer of their own once
+// it's clear that only the effects applied on top of them are changing, and that layer is composited with the current
+// transform and opacity from then on. Layers are rasterized in the stacking context's own coordinate space, so a
+// transform that scales the contents up scales the layer's pixels rather than rasterizing the contents at a larger size.
+bool DisplayListPlayerSkia::paint_stacking_context_from_cache(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, size_t push_stacking_context_index, PushStackingContext const& command)
+{
+    if (command.clip_path.has_value() || !command.bounding_rect.has_value())
+        return false;
+
+    // NOTE: There's nothing to gain from caching the contents of a stacking context that merely groups them.
+    if (command.opacity == 1.0f && command.transform.is_identity() && !command.transform.parent_perspective_matrix.has_value())
+        return false;
+
+    auto const& rect = command.bounding_rect.value();
+    if (rect.is_empty() || static_cast<i64>(rect.width()) * rect.height() > max_cached_layer_pixels)
+        return false;
+
+    // NOTE: The key only has to find the same stacking context again in the next frame's display list. Stacking contexts
+    //       that happen to share a key are told apart by their contents before a layer is ever used.
+    Fingerprint key;
+    key.add(push_stacking_context_index);
+    key.add(command.matching_pop_index - push_stacking_context_index);
+    key.add(rect);
+
+    Fingerprint effects_fingerprint;
+    effects_fingerprint.add(command.opacity);
+    effects_fingerprint.add(command.compositing_and_blending_operator);
+    effects_fingerprint.add(command.isolate);
+    effects_fingerprint.add(command.transform.origin);
+    effects_fingerprint.add(command.transform.matrix);
+    if (command.transform.parent_perspective_matrix.has_value())
+        effects_fingerprint.add(command.transform.parent_perspective_matrix.value());
+
+    auto& cached_layer = *m_cached_layers.ensure(key.value(), [&] {
+        auto cached_layer = make<CachedLayer>();
+        cached_layer->key = key.value();
+        cached_layer->effects_fingerprint = effects_fingerprint.value();
+        return cached_layer;
+    });
+    m_cached_layers_by_last_use.append(cached_layer);
+    if (cached_layer.effects_fingerprint != effects_fingerprint.value()) {
+        cached_layer.effects_fingerprint = effects_fingerprint.value();
+        cached_layer.effects_changed = true;
+    }
+
+    // NOTE: Stacking contexts whose effects have never changed are painted normally without looking at their contents.
+    if (!cached_layer.effects_changed) {
+        evict_cached_layers_if_needed();
+        return false;
+    }
+
+    // NOTE: The contents only need to be compared once per replay, even if the display list is played once per damaged
+    //       rect.
+    if (cached_layer.contents_checked_in_replay != replay_generation() || cached_layer.display_list.ptr() != &display_list) {
+        auto contents_fingerprint = fingerprint_for_stacking_context_contents(display_list, scroll_state, push_stacking_context_index, command);
+        cached_layer.contents_unchanged = contents_fingerprint.has_value() && contents_fingerprint == cached_layer.contents_fingerprint;
+        if (!cached_layer.contents_unchanged) {
+            // The contents are new or have changed, so they're painted normally until they're seen unchanged again.
+            cached_layer.contents_fingerprint = contents_fingerprint;
+            discard_cached_layer_surface(cached_layer);
+        }
+        cached_layer.contents_checked_in_replay = replay_generation();
+        cached_layer.display_list = display_list;
+    }
+
+    if (!cached_layer.contents_unchanged) {
+        evict_cached_layers_if_needed();
+        return false;
+    }
+
+    if (cached_layer.surface) {
+        ++m_cached_layer_reuse_count;
+    } else {
+        auto layer_surface = Gfx::PaintingSurface::create_with_size(m_context, rect.size(), Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied);
+        auto& layer_canvas = layer_surface->canvas();
+        layer_canvas.save();
+        layer_canvas.translate(-rect.x(), -rect.y());
+
+        // NOTE: Painting the contents may cache layers of nested stacking contexts, so this one is kept out of the list of
+        //       layers to evict while that happens.
+        m_cached_layers_by_last_use.remove(cached_layer);
+        execute_impl(display_list, scroll_state, layer_surface, push_stacking_context_index + 1, command.matching_pop_index);
+        m_cached_layers_by_last_use.append(cached_layer);
+
+        layer_canvas.restore();
+        cached_layer.surface = layer_surface;
+        m_cached_layers_size_in_bytes += static_cast<size_t>(rect.width()) * rect.height() * 4;
+    }
+
+    auto& canvas = surface().canvas();
+    canvas.save();
+    canvas.concat(to_skia_matrix4x4(command.transform));
+    SkPaint paint;
+    paint.setAlphaf(command.opacity);
+    paint.setBlender(Gfx::to_skia_blender(command.compositing_and_blending_operator));
+    auto image = cached_layer.surface->sk_surface().makeImageSnapshot();
+    canvas.drawImage(image, rect.x(), rect.y(), SkSamplingOptions(SkFilterMode::kLinear), &paint);
+    canvas.restore();
+
+    evict_cached_layers_if_needed();
+    return true;
+}
+
+void DisplayListPlayerSkia::discard_cached_layer_surface(CachedLayer& cached_layer)
+{
+    if (!cached_layer.surface)
+        return;
+    auto size = cached_layer.surface->size();
+    m_cached_layers_size_in_bytes -= static_cast<size_t>(size.width()) * size.height() * 4;
+    cached_layer.surface = nullptr;
+}
+
+void DisplayListPlayerSkia::evict_cached_layers_if_needed()
+{
+    while (m_cached_layers.size() > max_cached_layers || m_cached_layers_size_in_bytes > max_cached_layers_size_in_bytes) {
+        auto* least_recently_used = m_cached_layers_by_last_use.take_first();
+        if (!least_recently_used)
+            break;
+        discard_cached_layer_surface(*least_recently_used);
+        m_cached_layers.remove(least_recently_used->key);
+    }
+}
+
 static ColorStopList replace_transition_hints_with_normal_color_stops(ColorStopList const& color_stop_list)
 {
     ColorStopList stops_with_replaced_transition_hints;
@@ -1062,4 +1249,15 @@ bool DisplayListPlayerSkia::would_be_fully_clipped_by_painter(Gfx::IntRect rect)
     return surface().canvas().quickReject(to_skia_rect(rect));
 }
 
+Gfx::IntRect DisplayListPlayerSkia::local_clip_bounds() const
+{
+    // NOTE: Under a transform that shrinks things a lot, the clip bounds can get too large to fit into an IntRect.
+    static constexpr float limit = 1 << 29;
+    auto bounds = surface().canvas().getLocalClipBounds();
+    if (!bounds.intersect(SkRect::MakeLTRB(-limit, -limit, limit, limit)))
+        return {};
+    auto rounded_bounds = bounds.roundOut();
+    return { rounded_bounds.x(), rounded_bounds.y(), rounded_bounds.width(), rounded_bounds.height() };
+}
+
 }
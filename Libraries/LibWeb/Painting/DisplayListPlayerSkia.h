@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <AK/IntrusiveList.h>
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/DisplayListCommand.h>
@@ -21,6 +23,9 @@ public:
     DisplayListPlayerSkia();
     ~DisplayListPlayerSkia();
 
+    // The number of times a stacking context has been painted from a layer that was already rasterized.
+    size_t cached_layer_reuse_count() const { return m_cached_layer_reuse_count; }
+
 private:
     void flush() override;
     void draw_glyph_run(DrawGlyphRun const&) override;
@@ -58,11 +63,41 @@ private:
     void apply_filter(ApplyFilter const&) override;
     void apply_transform(ApplyTransform const&) override;
     void apply_mask_bitmap(ApplyMaskBitmap const&) override;
+    bool paint_stacking_context_from_cache(DisplayList&, ScrollStateSnapshot const&, size_t push_stacking_context_index, PushStackingContext const&) override;
 
     bool would_be_fully_clipped_by_painter(Gfx::IntRect) const override;
+    Gfx::IntRect local_clip_bounds() const override;
 
     RefPtr<Gfx::SkiaBackendContext> m_context;
 
+    // Stacking contexts that may be worth painting from a layer, keyed by a cheap fingerprint of where they are in the
+    // display list. See paint_stacking_context_from_cache() for when their layers are made and used.
+    struct CachedLayer {
+        u64 key { 0 };
+        u64 effects_fingerprint { 0 };
+        bool effects_changed { false };
+
+        // Only computed once the effects have changed, and at most once per replay.
+        Optional<u64> contents_fingerprint;
+        bool contents_unchanged { false };
+        u64 contents_checked_in_replay { 0 };
+
+        RefPtr<Gfx::PaintingSurface> surface;
+
+        // NOTE: Fingerprints include the addresses of glyph runs and bitmaps, so the display list the contents were last
+        //       checked in is kept alive to make sure none of those addresses get reused for something else.
+        RefPtr<DisplayList> display_list;
+
+        IntrusiveListNode<CachedLayer> list_node;
+        using List = IntrusiveList<&CachedLayer::list_node>;
+    };
+    HashMap<u64, NonnullOwnPtr<CachedLayer>> m_cached_layers;
+    CachedLayer::List m_cached_layers_by_last_use;
+    size_t m_cached_layers_size_in_bytes { 0 };
+    size_t m_cached_layer_reuse_count { 0 };
+    void discard_cached_layer_surface(CachedLayer&);
+    void evict_cached_layers_if_needed();
+
     struct CachedRuntimeEffects;
     OwnPtr<CachedRuntimeEffects> m_cached_runtime_effects;
     CachedRuntimeEffects& cached_runtime_effects();
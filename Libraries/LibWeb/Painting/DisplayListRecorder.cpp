@@ -34,6 +34,7 @@ DisplayListRecorder::DisplayListRecorder(DisplayList& command_list)
 DisplayListRecorder::~DisplayListRecorder()
 {
     restore();
+    m_display_list.finalize({});
 }
 
 template<typename T>
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <AK/QuickSort.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListSpatialIndex.h>
+
+namespace Web::Painting {
+
+static constexpr size_t min_commands_to_index = 1024;
+static constexpr size_t min_commands_in_run = 64;
+static constexpr int band_height = 256;
+static constexpr int max_bands_per_entry = 16;
+
+static int band_containing(int y)
+{
+    if (y >= 0)
+        return y / band_height;
+    return -((-y + band_height - 1) / band_height);
+}
+
+static bool command_only_paints(DisplayListCommand const& command)
+{
+    return command.visit([](auto const& command) {
+        if constexpr (requires { command.nesting_level_change; })
+            return false;
+        else if constexpr (requires { command.is_clip_or_mask(); })
+            return false;
+        else if constexpr (requires { command.bounding_rect(); })
+            return true;
+        else
+            return false;
+    });
+}
+
+static Gfx::IntRect command_bounding_rect(DisplayListCommand const& command)
+{
+    return command.visit([](auto const& command) -> Gfx::IntRect {
+        if constexpr (requires { command.bounding_rect(); })
+            return command.bounding_rect();
+        else
+            VERIFY_NOT_REACHED();
+    });
+}
+
+static DisplayListSpatialIndex::Run create_run(DisplayList const& display_list, size_t start, size_t end)
+{
+    using Run = DisplayListSpatialIndex::Run;
+
+    Run run { .start = start, .end = end, .groups = {} };
+    HashMap<Optional<i32>, size_t> group_index_by_scroll_frame_id;
+    for (auto command_index = start; command_index < end; ++command_index) {
+        auto const& command_list_item = display_list.commands()[command_index];
+        auto rect = command_bounding_rect(command_list_item.command);
+
+        // NOTE: Commands with empty bounding rects are never painted, so there's no need to ever find them.
+        if (rect.is_empty())
+            continue;
+
+        auto group_index = group_index_by_scroll_frame_id.ensure(command_list_item.scroll_frame_id, [&] {
+            run.groups.append({ .scroll_frame_id = command_list_item.scroll_frame_id, .entries = {}, .first_band = 0, .bands = {}, .oversized_entries = {} });
+            return run.groups.size() - 1;
+        });
+        run.groups[group_index].entries.append({ command_index, rect });
+    }
+
+    for (auto& group : run.groups) {
+        auto first_band = NumericLimits<int>::max();
+        auto last_band = NumericLimits<int>::min();
+        for (auto const& entry : group.entries) {
+            first_band = min(first_band, band_containing(entry.rect.top()));
+            last_band = max(last_band, band_containing(entry.rect.bottom() - 1));
+        }
+
+        group.first_band = first_band;
+        group.bands.resize(last_band - first_band + 1);
+        for (u32 entry_index = 0; entry_index < group.entries.size(); ++entry_index) {
+            auto const& rect = group.entries[entry_index].rect;
+            auto entry_first_band = band_containing(rect.top());
+            auto entry_last_band = band_containing(rect.bottom() - 1);
+            if (entry_last_band - entry_first_band >= max_bands_per_entry) {
+                group.oversized_entries.append(entry_index);
+                continue;
+            }
+            for (auto band = entry_first_band; band <= entry_last_band; ++band)
+                group.bands[band - first_band].append(entry_index);
+        }
+    }
+    return run;
+}
+
+OwnPtr<DisplayListSpatialIndex> DisplayListSpatialIndex::create(DisplayList const& display_list)
+{
+    auto const& commands = display_list.commands();
+    if (commands.size() < min_commands_to_index)
+        return {};
+
+    Vector<Run> runs;
+    size_t command_index = 0;
+    while (command_index < commands.size()) {
+        if (!command_only_paints(commands[command_index].command)) {
+            ++command_index;
+            continue;
+        }
+        auto start = command_index;
+        while (command_index < commands.size() && command_only_paints(commands[command_index].command))
+            ++command_index;
+        if (command_index - start >= min_commands_in_run)
+            runs.append(create_run(display_list, start, command_index));
+    }
+
+    if (runs.is_empty())
+        return {};
+    return adopt_own(*new DisplayListSpatialIndex(move(runs)));
+}
+
+DisplayListSpatialIndex::DisplayListSpatialIndex(Vector<Run>&& runs)
+    : m_runs(move(runs))
+{
+}
+
+void DisplayListSpatialIndex::find_commands_intersecting(Run const& run, Gfx::IntRect const& rect, ScrollStateSnapshot const& scroll_state, double device_pixels_per_css_pixel, Vector<size_t>& command_indices) const
+{
+    auto initial_size = command_indices.size();
+
+    for (auto const& group : run.groups) {
+        // NOTE: Commands are scrolled by whole device pixels in the same way the player does it, and the rect is
+        //       inflated a little to make up for commands whose bounding rects round differently once moved.
+        auto local_rect = rect.inflated(2, 2);
+        if (group.scroll_frame_id.has_value()) {
+            auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(group.scroll_frame_id.value());
+            auto scroll_offset = cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
+            local_rect.translate_by(-scroll_offset);
+        }
+
+        auto add_if_intersecting = [&](u32 entry_index) {
+            auto const& entry = group.entries[entry_index];
+            if (entry.rect.intersects(local_rect))
+                command_indices.append(entry.command_index);
+        };
+
+        for (auto entry_index : group.oversized_entries)
+            add_if_intersecting(entry_index);
+
+        auto first_band = max(band_containing(local_rect.top()), group.first_band);
+        auto last_band = min(band_containing(local_rect.bottom() - 1), group.first_band + static_cast<int>(group.bands.size()) - 1);
+        for (auto band = first_band; band <= last_band; ++band) {
+            for (auto entry_index : group.bands[band - group.first_band]) {
+                // A command overlapping several bands is only added from the first of them that's looked at.
+                auto entry_first_band = band_containing(group.entries[entry_index].rect.top());
+                if (max(entry_first_band, first_band) != band)
+                    continue;
+                add_if_intersecting(entry_index);
+            }
+        }
+    }
+
+    auto found_command_indices = command_indices.span().slice(initial_size);
+    quick_sort(found_command_indices, [](size_t a, size_t b) { return a > b; });
+}
+
+}
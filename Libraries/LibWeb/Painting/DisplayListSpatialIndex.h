@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/OwnPtr.h>
+#include <AK/Vector.h>
+#include <LibGfx/Rect.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/Painting/ScrollState.h>
+
+namespace Web::Painting {
+
+// Finds the commands of a display list that may paint into a region without looking at all the others.
+// Only runs of consecutive commands that do nothing but paint are indexed, since leaving those out of a replay has no
+// effect on the commands after them. Within a run, the commands are grouped by the scroll frame they are painted in and
+// sorted into horizontal bands by their bounding rects, so that looking up the commands near the viewport of a long
+// page only touches the bands it overlaps.
+// Rects are indexed as recorded, i.e. before scrolling, and lookups undo the scroll offset of each group instead.
+class DisplayListSpatialIndex {
+    AK_MAKE_NONCOPYABLE(DisplayListSpatialIndex);
+    AK_MAKE_NONMOVABLE(DisplayListSpatialIndex);
+
+public:
+    // Returns null if the display list is too short, or has no runs long enough, for an index to pay off.
+    static OwnPtr<DisplayListSpatialIndex> create(DisplayList const&);
+
+    struct Run {
+        size_t start { 0 };
+        size_t end { 0 };
+
+        struct Entry {
+            size_t command_index { 0 };
+            Gfx::IntRect rect;
+        };
+        struct Group {
+            Optional<i32> scroll_frame_id;
+            Vector<Entry> entries;
+
+            // Indices into entries of the commands overlapping each band, starting at first_band.
+            int first_band { 0 };
+            Vector<Vector<u32>> bands;
+
+            // Commands spanning too many bands to be worth adding to each of them are checked on every lookup instead.
+            Vector<u32> oversized_entries;
+        };
+        Vector<Group> groups;
+    };
+
+    ReadonlySpan<Run> runs() const { return m_runs; }
+
+    // Appends the indices of the commands in the run whose bounding rects, once scrolled, intersect the given rect, in
+    // descending order.
+    void find_commands_intersecting(Run const&, Gfx::IntRect const&, ScrollStateSnapshot const&, double device_pixels_per_css_pixel, Vector<size_t>& command_indices) const;
+
+private:
+    explicit DisplayListSpatialIndex(Vector<Run>&&);
+
+    Vector<Run> m_runs;
+};
+
+}
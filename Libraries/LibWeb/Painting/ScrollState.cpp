@@ -17,4 +17,13 @@ ScrollStateSnapshot ScrollStateSnapshot::create(Vector<NonnullRefPtr<ScrollFrame
     return snapshot;
 }
 
+ScrollStateSnapshot ScrollStateSnapshot::create_with_offsets(ReadonlySpan<CSSPixelPoint> offsets)
+{
+    ScrollStateSnapshot snapshot;
+    snapshot.entries.ensure_capacity(offsets.size());
+    for (auto offset : offsets)
+        snapshot.entries.append({ offset, offset });
+    return snapshot;
+}
+
 }
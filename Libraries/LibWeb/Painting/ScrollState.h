@@ -14,6 +14,9 @@ class ScrollStateSnapshot {
 public:
     static ScrollStateSnapshot create(Vector<NonnullRefPtr<ScrollFrame>> const& scroll_frames);
 
+    // Creates a snapshot of frames that have no scrolled ancestors, each scrolled by the offset at its id.
+    static ScrollStateSnapshot create_with_offsets(ReadonlySpan<CSSPixelPoint> offsets);
+
     CSSPixelPoint cumulative_offset_for_frame_with_id(size_t id) const
     {
         if (id >= entries.size())
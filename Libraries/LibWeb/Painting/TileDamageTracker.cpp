@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibWeb/Painting/DevicePixelConverter.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListCommandFingerprint.h>
+#include <LibWeb/Painting/TileDamageTracker.h>
+
+namespace Web::Painting {
+
+// Surfaces that nothing but the tracker holds on to anymore are forgotten right away, this only guards against
+// remembering an unbounded number of them.
+static constexpr size_t max_painted_surfaces = 4;
+
+static bool command_changes_canvas_state(DisplayListCommand const& command)
+{
+    return command.has<Translate>()
+        || command.has<AddClipRect>()
+        || command.has<AddRoundedRectClip>()
+        || command.has<AddMask>()
+        || command.has<ApplyTransform>()
+        || command.has<ApplyMaskBitmap>();
+}
+
+static int nesting_level_change_for_command(DisplayListCommand const& command)
+{
+    return command.visit([](auto const& command) {
+        if constexpr (requires { command.nesting_level_change; })
+            return command.nesting_level_change;
+        else
+            return 0;
+    });
+}
+
+// Returns whether the command leaves where subsequent commands end up on the surface unchanged.
+static bool command_keeps_geometry(DisplayListCommand const& command)
+{
+    return command.visit(
+        [](Translate const& command) { return command.delta.is_zero(); },
+        [](ApplyTransform const& command) { return command.matrix.is_identity(); },
+        [](PushStackingContext const& command) { return command.transform.is_identity() && !command.transform.parent_perspective_matrix.has_value(); },
+        // NOTE: Filters may move pixels anywhere, e.g. a blur or a drop shadow spreads them out.
+        [](ApplyFilter const&) { return false; },
+        [](auto const&) { return true; });
+}
+
+// Returns the part of the surface a command paints into before clipping, if it can be told from the command alone.
+static Optional<Gfx::IntRect> area_for_command(DisplayListCommand const& command)
+{
+    return command.visit(
+        [](DrawLine const& command) -> Optional<Gfx::IntRect> {
+            return Gfx::IntRect::from_two_points(command.from, command.to).inflated(command.thickness * 2, command.thickness * 2);
+        },
+        [](PaintScrollBar const& command) -> Optional<Gfx::IntRect> {
+            return command.gutter_rect.united(command.thumb_rect);
+        },
+        [](auto const& command) -> Optional<Gfx::IntRect> {
+            if constexpr (requires { command.bounding_rect(); })
+                return command.bounding_rect();
+            else
+                return {};
+        });
+}
+
+static Vector<Gfx::IntRect> rects_for_dirty_tiles(Vector<bool> const& dirty_tiles, int columns, int rows, Gfx::IntSize surface_size)
+{
+    auto const tile_size = TileDamageTracker::tile_size;
+    Vector<Gfx::IntRect> rects;
+    for (int row = 0; row < rows; ++row) {
+        for (int column = 0; column < columns;) {
+            if (!dirty_tiles[row * columns + column]) {
+                ++column;
+                continue;
+            }
+            auto first_column = column;
+            while (column < columns && dirty_tiles[row * columns + column])
+                ++column;
+            Gfx::IntRect rect { first_column * tile_size, row * tile_size, (column - first_column) * tile_size, tile_size };
+
+            // Grow a rect from the row above if it spans the exact same columns, so large damage stays a single rect.
+            auto rect_above = rects.find_if([&](auto const& candidate) {
+                return candidate.x() == rect.x() && candidate.width() == rect.width() && candidate.y() + candidate.height() == rect.y();
+            });
+            if (rect_above != rects.end())
+                rect_above->set_height(rect_above->height() + tile_size);
+            else
+                rects.append(rect);
+        }
+    }
+
+    Gfx::IntRect surface_rect { {}, surface_size };
+    for (auto& rect : rects)
+        rect.intersect(surface_rect);
+    return rects;
+}
+
+Vector<Gfx::IntRect> TileDamageTracker::compute_damage(Gfx::PaintingSurface& surface, DisplayList& display_list, ScrollStateSnapshotByDisplayList const& scroll_state_snapshot_by_display_list)
+{
+    ++m_frame_number;
+
+    m_painted_surfaces.remove_all_matching([](auto const& painted_surface) {
+        return painted_surface.surface->ref_count() == 1;
+    });
+
+    auto surface_size = surface.size();
+    Gfx::IntRect surface_rect { {}, surface_size };
+    auto columns = ceil_div(surface_size.width(), tile_size);
+    auto rows = ceil_div(surface_size.height(), tile_size);
+
+    Vector<u64> tile_fingerprints;
+    tile_fingerprints.resize(columns * rows);
+
+    auto add_to_tiles = [&](Gfx::IntRect area, u64 fingerprint) {
+        area.intersect(surface_rect);
+        if (area.is_empty())
+            return;
+        auto last_column = (area.x() + area.width() - 1) / tile_size;
+        auto last_row = (area.y() + area.height() - 1) / tile_size;
+        for (auto row = area.y() / tile_size; row <= last_row; ++row) {
+            for (auto column = area.x() / tile_size; column <= last_column; ++column) {
+                auto& tile_fingerprint = tile_fingerprints[row * columns + column];
+                tile_fingerprint = combine_fingerprints(tile_fingerprint, fingerprint);
+            }
+        }
+    };
+
+    auto scroll_state = scroll_state_snapshot_by_display_list.get(display_list).value_or({});
+    auto device_pixels_per_css_pixel = display_list.device_pixels_per_css_pixel();
+    DevicePixelConverter device_pixel_converter { device_pixels_per_css_pixel };
+
+    struct ClipFrameFingerprint {
+        u64 fingerprint { 0 };
+        Optional<Gfx::IntRect> bounds;
+    };
+    HashMap<ClipFrame const*, ClipFrameFingerprint> clip_frame_fingerprints;
+    auto fingerprint_for_clip_frame = [&](ClipFrame const& clip_frame) -> ClipFrameFingerprint const& {
+        return clip_frame_fingerprints.ensure(&clip_frame, [&] {
+            // NOTE: This mirrors how DisplayListPlayer::apply_clip_frame() turns clip rects into device pixels.
+            Fingerprint fingerprint;
+            Optional<Gfx::IntRect> bounds;
+            for (auto const& clip_rect : clip_frame.clip_rects()) {
+                auto css_rect = clip_rect.rect;
+                if (auto enclosing_scroll_frame_id = clip_rect.enclosing_scroll_frame_id; enclosing_scroll_frame_id.has_value())
+                    css_rect.translate_by(scroll_state.cumulative_offset_for_frame_with_id(enclosing_scroll_frame_id.value()));
+                auto device_rect = device_pixel_converter.rounded_device_rect(css_rect).to_type<int>();
+                fingerprint.add(device_rect);
+                fingerprint.add(clip_rect.corner_radii.as_corners(device_pixel_converter));
+                bounds = bounds.has_value() ? bounds->intersected(device_rect) : device_rect;
+            }
+            return ClipFrameFingerprint { fingerprint.value(), bounds };
+        });
+    };
+
+    // The canvas state that commands are painted with, i.e. everything that was saved and not yet restored.
+    struct CanvasState {
+        u64 fingerprint { 0 };
+        bool geometry_is_known { true };
+        Optional<Gfx::IntRect> clip;
+    };
+    Vector<CanvasState> canvas_states;
+    canvas_states.append({});
+
+    bool needs_full_damage = false;
+
+    for (auto const& [scroll_frame_id, clip_frame, original_command] : display_list.commands()) {
+        // NOTE: Commands are moved around the same way DisplayListPlayer::execute_impl() does before painting them.
+        auto command = original_command;
+        if (command.has<PaintScrollBar>()) {
+            auto& paint_scroll_bar = command.get<PaintScrollBar>();
+            auto scroll_offset = scroll_state.own_offset_for_frame_with_id(paint_scroll_bar.scroll_frame_id);
+            if (paint_scroll_bar.vertical) {
+                auto offset = scroll_offset.y() * paint_scroll_bar.scroll_size;
+                paint_scroll_bar.thumb_rect.translate_by(0, -offset.to_int() * device_pixels_per_css_pixel);
+            } else {
+                auto offset = scroll_offset.x() * paint_scroll_bar.scroll_size;
+                paint_scroll_bar.thumb_rect.translate_by(-offset.to_int() * device_pixels_per_css_pixel, 0);
+            }
+        }
+        if (scroll_frame_id.has_value()) {
+            auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id.value());
+            auto scroll_offset = cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
+            command.visit([scroll_offset](auto& command) {
+                if constexpr (requires { command.translate_by(scroll_offset); })
+                    command.translate_by(scroll_offset);
+            });
+        }
+
+        // A backdrop filter reads back pixels from around it, which may belong to tiles that are not repainted.
+        if (command.has<ApplyBackdropFilter>())
+            needs_full_damage = true;
+
+        Fingerprint fingerprint { canvas_states.last().fingerprint };
+        fingerprint.add(fingerprint_for_command(command).value_or(m_frame_number));
+
+        Optional<Gfx::IntRect> clip_frame_bounds;
+        if (clip_frame) {
+            auto const& clip_frame_fingerprint = fingerprint_for_clip_frame(*clip_frame);
+            fingerprint.add(clip_frame_fingerprint.fingerprint);
+            clip_frame_bounds = clip_frame_fingerprint.bounds;
+        }
+
+        if (auto nesting_level_change = nesting_level_change_for_command(command); nesting_level_change < 0) {
+            if (canvas_states.size() > 1)
+                (void)canvas_states.take_last();
+            continue;
+        } else if (nesting_level_change > 0) {
+            canvas_states.append(canvas_states.last());
+        }
+
+        auto& canvas_state = canvas_states.last();
+        if (nesting_level_change_for_command(command) > 0 || command_changes_canvas_state(command)) {
+            canvas_state.fingerprint = fingerprint.value();
+            if (!command_keeps_geometry(command))
+                canvas_state.geometry_is_known = false;
+            if (command.has<AddClipRect>() || command.has<AddRoundedRectClip>()) {
+                auto clip_rect = *area_for_command(command);
+                canvas_state.clip = canvas_state.clip.has_value() ? canvas_state.clip->intersected(clip_rect) : clip_rect;
+            }
+            continue;
+        }
+
+        if (!canvas_state.geometry_is_known) {
+            add_to_tiles(surface_rect, fingerprint.value());
+            continue;
+        }
+
+        auto area = area_for_command(command).value_or(surface_rect);
+        if (clip_frame_bounds.has_value())
+            area.intersect(*clip_frame_bounds);
+        if (canvas_state.clip.has_value())
+            area.intersect(*canvas_state.clip);
+        add_to_tiles(area, fingerprint.value());
+    }
+
+    auto painted_surface = m_painted_surfaces.find_if([&](auto const& painted_surface) {
+        return painted_surface.surface.ptr() == &surface;
+    });
+
+    Vector<Gfx::IntRect> damage;
+    if (needs_full_damage || painted_surface == m_painted_surfaces.end() || painted_surface->size != surface_size) {
+        damage.append(surface_rect);
+    } else {
+        Vector<bool> dirty_tiles;
+        dirty_tiles.resize(tile_fingerprints.size());
+        for (size_t i = 0; i < tile_fingerprints.size(); ++i)
+            dirty_tiles[i] = tile_fingerprints[i] != painted_surface->tile_fingerprints[i];
+        damage = rects_for_dirty_tiles(dirty_tiles, columns, rows, surface_size);
+    }
+
+    if (painted_surface != m_painted_surfaces.end()) {
+        painted_surface->size = surface_size;
+        painted_surface->tile_fingerprints = move(tile_fingerprints);
+        painted_surface->display_list = display_list;
+    } else {
+        if (m_painted_surfaces.size() >= max_painted_surfaces)
+            (void)m_painted_surfaces.take_first();
+        m_painted_surfaces.append({ surface, surface_size, move(tile_fingerprints), display_list });
+    }
+
+    return damage;
+}
+
+}
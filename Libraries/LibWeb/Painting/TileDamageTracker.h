@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Vector.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/Rect.h>
+#include <LibGfx/Size.h>
+#include <LibWeb/Export.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/Painting/ScrollState.h>
+
+namespace Web::Painting {
+
+// Works out which parts of a painting surface have to be repainted for it to show a display list, given the display
+// list that was last painted into that same surface.
+// The surface is divided into fixed-size tiles, and every tile gets a fingerprint of the commands that paint into it,
+// along with the clips, scroll offsets and canvas state they are painted with. Tiles whose fingerprint is unchanged
+// since the surface was last painted still hold the right pixels and don't have to be repainted.
+// Fingerprints are kept per surface, so double-buffered backing stores are handled naturally: the damage to a back
+// buffer covers everything that changed since it was last painted, not just since the previous frame.
+// Commands whose effect can't be tied to a region of the surface (e.g. anything under a non-trivial transform) are
+// charged to every tile, and commands that can't be fingerprinted (e.g. canvases, which change without the display
+// list changing) damage their tiles on every frame, so the damage is always conservative.
+class WEB_API TileDamageTracker {
+    AK_MAKE_NONCOPYABLE(TileDamageTracker);
+    AK_MAKE_NONMOVABLE(TileDamageTracker);
+
+public:
+    static constexpr int tile_size = 256;
+
+    TileDamageTracker() = default;
+
+    // Returns the rects of the surface that have to be repainted for it to show the display list, and remembers the
+    // display list as the surface's new contents. The rects are tile-aligned and clipped to the surface.
+    Vector<Gfx::IntRect> compute_damage(Gfx::PaintingSurface&, DisplayList&, ScrollStateSnapshotByDisplayList const&);
+
+private:
+    struct PaintedSurface {
+        NonnullRefPtr<Gfx::PaintingSurface> surface;
+        Gfx::IntSize size;
+        Vector<u64> tile_fingerprints;
+
+        // NOTE: Fingerprints refer to glyph runs, bitmaps and such by address, so the display list they were computed
+        //       from is kept alive to make sure none of those addresses get reused for something else.
+        NonnullRefPtr<DisplayList> display_list;
+    };
+
+    Vector<PaintedSurface> m_painted_surfaces;
+    u64 m_frame_number { 0 };
+};
+
+}
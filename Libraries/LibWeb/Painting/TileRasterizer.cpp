@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/TileDamageTracker.h>
+#include <LibWeb/Painting/TileRasterizer.h>
+
+namespace Web::Painting {
+
+static size_t g_tile_rasterization_thread_count = 0;
+
+void set_tile_rasterization_thread_count(size_t thread_count)
+{
+    g_tile_rasterization_thread_count = thread_count;
+}
+
+size_t tile_rasterization_thread_count()
+{
+    return g_tile_rasterization_thread_count;
+}
+
+ErrorOr<NonnullOwnPtr<TileRasterizer>> TileRasterizer::create(size_t thread_count)
+{
+    VERIFY(thread_count > 0);
+
+    Vector<Worker> workers;
+    TRY(workers.try_ensure_capacity(thread_count));
+    for (size_t i = 0; i < thread_count; ++i) {
+        workers.unchecked_append({
+            .thread = TRY(Threading::WorkerThread<Error>::create("TileRasterizer"sv)),
+            .player = make<DisplayListPlayerSkia>(),
+        });
+    }
+    return adopt_nonnull_own_or_enomem(new (nothrow) TileRasterizer(move(workers)));
+}
+
+TileRasterizer::TileRasterizer(Vector<Worker>&& workers)
+    : m_workers(move(workers))
+{
+}
+
+TileRasterizer::~TileRasterizer() = default;
+
+bool TileRasterizer::can_rasterize(DisplayList const& display_list)
+{
+    for (auto const& command_list_item : display_list.commands()) {
+        auto const& command = command_list_item.command;
+
+        // NOTE: Painting surfaces (i.e. canvases) are snapshotted while painting, which must not happen on several
+        //       threads at once, and backdrop filters read back pixels from around them, which may be in another tile.
+        if (command.has<DrawPaintingSurface>() || command.has<ApplyBackdropFilter>())
+            return false;
+
+        if (auto const* paint_nested_display_list = command.get_pointer<PaintNestedDisplayList>(); paint_nested_display_list && paint_nested_display_list->display_list) {
+            if (!can_rasterize(*paint_nested_display_list->display_list))
+                return false;
+        }
+        if (auto const* add_mask = command.get_pointer<AddMask>(); add_mask && add_mask->display_list) {
+            if (!can_rasterize(*add_mask->display_list))
+                return false;
+        }
+    }
+    return true;
+}
+
+bool TileRasterizer::rasterize(DisplayList& display_list, ScrollStateSnapshotByDisplayList const& scroll_state_snapshot_by_display_list, Gfx::PaintingSurface& surface, ReadonlySpan<Gfx::IntRect> rects)
+{
+    struct Tile {
+        Gfx::IntRect rect;
+        NonnullRefPtr<Gfx::PaintingSurface> surface;
+    };
+
+    auto const tile_size = TileDamageTracker::tile_size;
+    Vector<Tile> tiles;
+    for (auto const& rect : rects) {
+        for (auto y = rect.y(); y < rect.y() + rect.height(); y += tile_size) {
+            for (auto x = rect.x(); x < rect.x() + rect.width(); x += tile_size) {
+                Gfx::IntRect tile_rect { x, y, min(tile_size, rect.x() + rect.width() - x), min(tile_size, rect.y() + rect.height() - y) };
+                auto tile_surface = surface.create_view_of_rect(tile_rect);
+                if (!tile_surface)
+                    return false;
+                tiles.append({ tile_rect, tile_surface.release_nonnull() });
+            }
+        }
+    }
+
+    // Threads pick the next tile that no one is painting yet until there are none left, so a few tiles that take long
+    // to paint don't hold up the whole frame.
+    Atomic<size_t> next_tile_index { 0 };
+    for (auto& worker : m_workers) {
+        auto started = worker.thread->start_task([&tiles, &next_tile_index, &display_list, &scroll_state_snapshot_by_display_list, &player = *worker.player]() -> ErrorOr<void, Error> {
+            while (true) {
+                auto tile_index = next_tile_index.fetch_add(1);
+                if (tile_index >= tiles.size())
+                    return {};
+                auto& tile = tiles[tile_index];
+                auto scroll_state_snapshot_by_display_list_copy = scroll_state_snapshot_by_display_list;
+                player.execute_tile(display_list, move(scroll_state_snapshot_by_display_list_copy), tile.surface, tile.rect);
+            }
+        });
+        VERIFY(started);
+    }
+
+    for (auto& worker : m_workers)
+        MUST(worker.thread->wait_until_task_is_finished());
+
+    surface.flush();
+    return true;
+}
+
+}
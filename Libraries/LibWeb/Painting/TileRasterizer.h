@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Vector.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/Rect.h>
+#include <LibThreading/WorkerThread.h>
+#include <LibWeb/Export.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/Painting/ScrollState.h>
+
+namespace Web::Painting {
+
+// Paints a display list into a memory-backed surface on several threads at once. The rects to paint are split into
+// tiles, and each thread paints one tile after another into a view of just that tile's pixels, skipping the commands
+// that fall outside of it. This makes full-page rasterization with the CPU backend scale with the number of cores.
+class WEB_API TileRasterizer {
+    AK_MAKE_NONCOPYABLE(TileRasterizer);
+    AK_MAKE_NONMOVABLE(TileRasterizer);
+
+public:
+    static ErrorOr<NonnullOwnPtr<TileRasterizer>> create(size_t thread_count);
+    ~TileRasterizer();
+
+    // Some commands depend on state that isn't safe to use from several threads at once or read back pixels from
+    // neighbouring tiles, so display lists containing them have to be painted in one go.
+    static bool can_rasterize(DisplayList const&);
+
+    // Paints the given rects of the surface. Returns false without painting anything if the surface isn't backed by
+    // memory, in which case it has to be painted some other way.
+    bool rasterize(DisplayList&, ScrollStateSnapshotByDisplayList const&, Gfx::PaintingSurface&, ReadonlySpan<Gfx::IntRect>);
+
+private:
+    struct Worker {
+        NonnullOwnPtr<Threading::WorkerThread<Error>> thread;
+        NonnullOwnPtr<DisplayListPlayerSkia> player;
+    };
+
+    explicit TileRasterizer(Vector<Worker>&&);
+
+    Vector<Worker> m_workers;
+};
+
+WEB_API void set_tile_rasterization_thread_count(size_t);
+size_t tile_rasterization_thread_count();
+
+}
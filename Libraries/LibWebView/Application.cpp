@@ -111,12 +111,15 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     Optional<StringView> dns_server_address;
     Optional<StringView> default_time_zone;
     Optional<u16> dns_server_port;
+    Optional<size_t> rasterization_threads;
     bool use_dns_over_tls = false;
     bool layout_test_mode = false;
     bool validate_dnssec_locally = false;
     bool log_all_js_exceptions = false;
     bool disable_site_isolation = false;
     bool enable_idl_tracing = false;
+    bool enable_style_recalc_tracing = false;
+    bool enable_rendering_phase_timings = false;
     bool disable_http_cache = false;
     bool enable_http_disk_cache = false;
     bool disable_content_filter = false;
@@ -133,7 +136,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
 
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Optional,
-        .help_string = "Run Ladybird without a browser window. Mode may be 'screenshot' (default), 'layout-tree', 'text', or 'manual'.",
+        .help_string = "Run Ladybird without a browser window. Mode may be 'screenshot' (default), 'layout-tree', 'text', 'style-recalc-trace', 'rendering-phase-timings', or 'manual'.",
         .long_name = "headless",
         .value_name = "mode",
         .accept_value = [&](StringView value) {
@@ -146,6 +149,10 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
                 headless_mode = HeadlessMode::LayoutTree;
             else if (value.equals_ignoring_ascii_case("text"sv))
                 headless_mode = HeadlessMode::Text;
+            else if (value.equals_ignoring_ascii_case("style-recalc-trace"sv))
+                headless_mode = HeadlessMode::StyleRecalcTrace;
+            else if (value.equals_ignoring_ascii_case("rendering-phase-timings"sv))
+                headless_mode = HeadlessMode::RenderingPhaseTimings;
             else if (value.equals_ignoring_ascii_case("manual"sv))
                 headless_mode = HeadlessMode::Manual;
 
@@ -168,6 +175,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(log_all_js_exceptions, "Log all JavaScript exceptions", "log-all-js-exceptions");
     args_parser.add_option(disable_site_isolation, "Disable site isolation", "disable-site-isolation");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
+    args_parser.add_option(enable_style_recalc_tracing, "Enable style recalc tracing", "enable-style-recalc-tracing");
+    args_parser.add_option(enable_rendering_phase_timings, "Enable rendering phase timings", "enable-rendering-phase-timings");
     args_parser.add_option(disable_http_cache, "Disable HTTP cache", "disable-http-cache");
     args_parser.add_option(enable_http_disk_cache, "Enable HTTP disk cache", "enable-http-disk-cache");
     args_parser.add_option(disable_content_filter, "Disable content filter", "disable-content-filter");
@@ -177,6 +186,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation", 'g');
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical scrollbars on the main viewport", "disable-scrollbar-painting");
+    args_parser.add_option(rasterization_threads, "Paint on this many threads at once (only used with CPU painting)", "rasterization-threads", 0, "count");
     args_parser.add_option(dns_server_address, "Set the DNS server address", "dns-server", 0, "host|address");
     args_parser.add_option(dns_server_port, "Set the DNS server port", "dns-port", 0, "port (default: 53 or 853 if --dot)");
     args_parser.add_option(use_dns_over_tls, "Use DNS over TLS", "dot");
@@ -273,6 +283,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .log_all_js_exceptions = log_all_js_exceptions ? LogAllJSExceptions::Yes : LogAllJSExceptions::No,
         .disable_site_isolation = disable_site_isolation ? DisableSiteIsolation::Yes : DisableSiteIsolation::No,
         .enable_idl_tracing = enable_idl_tracing ? EnableIDLTracing::Yes : EnableIDLTracing::No,
+        .enable_style_recalc_tracing = (enable_style_recalc_tracing || headless_mode == HeadlessMode::StyleRecalcTrace) ? EnableStyleRecalcTracing::Yes : EnableStyleRecalcTracing::No,
+        .enable_rendering_phase_timings = (enable_rendering_phase_timings || headless_mode == HeadlessMode::RenderingPhaseTimings) ? EnableRenderingPhaseTimings::Yes : EnableRenderingPhaseTimings::No,
         .enable_http_cache = disable_http_cache ? EnableHTTPCache::No : EnableHTTPCache::Yes,
         .expose_internals_object = expose_internals_object ? ExposeInternalsObject::Yes : ExposeInternalsObject::No,
         .force_cpu_painting = force_cpu_painting ? ForceCPUPainting::Yes : ForceCPUPainting::No,
@@ -280,6 +292,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .enable_autoplay = enable_autoplay ? EnableAutoplay::Yes : EnableAutoplay::No,
         .collect_garbage_on_every_allocation = collect_garbage_on_every_allocation ? CollectGarbageOnEveryAllocation::Yes : CollectGarbageOnEveryAllocation::No,
         .paint_viewport_scrollbars = disable_scrollbar_painting ? PaintViewportScrollbars::No : PaintViewportScrollbars::Yes,
+        .rasterization_thread_count = rasterization_threads,
         .default_time_zone = default_time_zone,
     };
 
@@ -548,6 +561,12 @@ ErrorOr<int> Application::execute()
             case HeadlessMode::Text:
                 load_page_for_info_and_exit(*m_event_loop, *view, m_browser_options.urls.first(), WebView::PageInfoType::Text);
                 break;
+            case HeadlessMode::StyleRecalcTrace:
+                load_page_for_info_and_exit(*m_event_loop, *view, m_browser_options.urls.first(), WebView::PageInfoType::StyleRecalcTrace);
+                break;
+            case HeadlessMode::RenderingPhaseTimings:
+                load_page_for_info_and_exit(*m_event_loop, *view, m_browser_options.urls.first(), WebView::PageInfoType::RenderingPhaseTimings);
+                break;
             case HeadlessMode::Manual:
                 load_page_and_exit_on_close(*m_event_loop, *view, m_browser_options.urls.first());
                 break;
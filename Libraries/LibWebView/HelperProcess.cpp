@@ -110,6 +110,10 @@ static ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_proc
         arguments.append("--disable-site-isolation"sv);
     if (web_content_options.enable_idl_tracing == WebView::EnableIDLTracing::Yes)
         arguments.append("--enable-idl-tracing"sv);
+    if (web_content_options.enable_style_recalc_tracing == WebView::EnableStyleRecalcTracing::Yes)
+        arguments.append("--enable-style-recalc-tracing"sv);
+    if (web_content_options.enable_rendering_phase_timings == WebView::EnableRenderingPhaseTimings::Yes)
+        arguments.append("--enable-rendering-phase-timings"sv);
     if (web_content_options.enable_http_cache == WebView::EnableHTTPCache::Yes)
         arguments.append("--enable-http-cache"sv);
     if (web_content_options.expose_internals_object == WebView::ExposeInternalsObject::Yes)
@@ -128,6 +132,11 @@ static ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_proc
         arguments.append(ByteString::number(maybe_echo_server_port.value()));
     }
 
+    if (auto const maybe_rasterization_thread_count = web_content_options.rasterization_thread_count; maybe_rasterization_thread_count.has_value()) {
+        arguments.append("--rasterization-threads"sv);
+        arguments.append(ByteString::number(maybe_rasterization_thread_count.value()));
+    }
+
     if (web_content_options.default_time_zone.has_value()) {
         arguments.append("--default-time-zone");
         arguments.append(web_content_options.default_time_zone.value());
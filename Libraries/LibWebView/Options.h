@@ -21,6 +21,8 @@ enum class HeadlessMode {
     Text,
     Manual,
     Test,
+    StyleRecalcTrace,
+    RenderingPhaseTimings,
 };
 
 enum class NewWindow {
@@ -119,6 +121,16 @@ enum class EnableIDLTracing {
     Yes,
 };
 
+enum class EnableStyleRecalcTracing {
+    No,
+    Yes,
+};
+
+enum class EnableRenderingPhaseTimings {
+    No,
+    Yes,
+};
+
 enum class EnableHTTPCache {
     No,
     Yes,
@@ -163,6 +175,8 @@ struct WebContentOptions {
     LogAllJSExceptions log_all_js_exceptions { LogAllJSExceptions::No };
     DisableSiteIsolation disable_site_isolation { DisableSiteIsolation::No };
     EnableIDLTracing enable_idl_tracing { EnableIDLTracing::No };
+    EnableStyleRecalcTracing enable_style_recalc_tracing { EnableStyleRecalcTracing::No };
+    EnableRenderingPhaseTimings enable_rendering_phase_timings { EnableRenderingPhaseTimings::No };
     EnableHTTPCache enable_http_cache { EnableHTTPCache::No };
     ExposeInternalsObject expose_internals_object { ExposeInternalsObject::No };
     ForceCPUPainting force_cpu_painting { ForceCPUPainting::No };
@@ -171,6 +185,7 @@ struct WebContentOptions {
     CollectGarbageOnEveryAllocation collect_garbage_on_every_allocation { CollectGarbageOnEveryAllocation::No };
     Optional<u16> echo_server_port {};
     PaintViewportScrollbars paint_viewport_scrollbars { PaintViewportScrollbars::Yes };
+    Optional<size_t> rasterization_thread_count {};
     Optional<StringView> default_time_zone {};
 };
 
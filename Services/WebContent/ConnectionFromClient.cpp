@@ -24,12 +24,14 @@
 #include <LibWeb/CSS/ComputedProperties.h>
 #include <LibWeb/CSS/Parser/ErrorReporter.h>
 #include <LibWeb/CSS/StyleComputer.h>
+#include <LibWeb/CSS/StyleRecalcTrace.h>
 #include <LibWeb/CookieStore/CookieStore.h>
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/CharacterData.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/ElementFactory.h>
+#include <LibWeb/DOM/RenderingPhaseTimings.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Dump.h>
@@ -998,6 +1000,40 @@ static void append_stacking_context_tree(Web::Page& page, StringBuilder& builder
     }
 }
 
+static void append_style_recalc_trace(Web::Page& page, StringBuilder& builder)
+{
+    auto* document = page.top_level_browsing_context().active_document();
+    if (!document) {
+        builder.append("(no DOM tree)"sv);
+        return;
+    }
+
+    auto* style_recalc_trace = document->style_computer().style_recalc_trace();
+    if (!style_recalc_trace) {
+        builder.append("(style recalc tracing is not enabled)"sv);
+        return;
+    }
+
+    builder.append(style_recalc_trace->to_json());
+}
+
+static void append_rendering_phase_timings(Web::Page& page, StringBuilder& builder)
+{
+    auto* document = page.top_level_browsing_context().active_document();
+    if (!document) {
+        builder.append("(no DOM tree)"sv);
+        return;
+    }
+
+    auto* rendering_phase_timings = document->rendering_phase_timings();
+    if (!rendering_phase_timings) {
+        builder.append("(rendering phase timings are not enabled)"sv);
+        return;
+    }
+
+    builder.append(rendering_phase_timings->to_json());
+}
+
 static void append_gc_graph(StringBuilder& builder)
 {
     auto gc_graph = Web::Bindings::main_thread_vm().heap().dump_graph();
@@ -1036,6 +1072,18 @@ void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::Page
         append_stacking_context_tree(page->page(), builder);
     }
 
+    if (has_flag(type, WebView::PageInfoType::StyleRecalcTrace)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_style_recalc_trace(page->page(), builder);
+    }
+
+    if (has_flag(type, WebView::PageInfoType::RenderingPhaseTimings)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_rendering_phase_timings(page->page(), builder);
+    }
+
     if (has_flag(type, WebView::PageInfoType::GCGraph)) {
         if (!builder.is_empty())
             builder.append("\n"sv);
@@ -19,6 +19,8 @@
 #include <LibRequests/RequestClient.h>
 #include <LibUnicode/TimeZone.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/CSS/StyleRecalcTrace.h>
+#include <LibWeb/DOM/RenderingPhaseTimings.h>
 #include <LibWeb/Fetch/Fetching/Fetching.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Internals/Internals.h>
@@ -27,6 +29,7 @@
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Painting/BackingStoreManager.h>
 #include <LibWeb/Painting/PaintableBox.h>
+#include <LibWeb/Painting/TileRasterizer.h>
 #include <LibWeb/Platform/EventLoopPluginSerenity.h>
 #include <LibWeb/WebIDL/Tracing.h>
 #include <LibWebView/Plugins/FontPlugin.h>
@@ -80,12 +83,15 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool log_all_js_exceptions = false;
     bool disable_site_isolation = false;
     bool enable_idl_tracing = false;
+    bool enable_style_recalc_tracing = false;
+    bool enable_rendering_phase_timings = false;
     bool enable_http_cache = false;
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
     bool collect_garbage_on_every_allocation = false;
     bool is_headless = false;
     bool disable_scrollbar_painting = false;
+    size_t rasterization_threads = 0;
     StringView echo_server_port_string_view {};
     StringView default_time_zone {};
 
@@ -103,11 +109,14 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(log_all_js_exceptions, "Log all JavaScript exceptions", "log-all-js-exceptions");
     args_parser.add_option(disable_site_isolation, "Disable site isolation", "disable-site-isolation");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
+    args_parser.add_option(enable_style_recalc_tracing, "Enable style recalc tracing", "enable-style-recalc-tracing");
+    args_parser.add_option(enable_rendering_phase_timings, "Enable rendering phase timings", "enable-rendering-phase-timings");
     args_parser.add_option(enable_http_cache, "Enable HTTP cache", "enable-http-cache");
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation");
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical viewport scrollbars", "disable-scrollbar-painting");
+    args_parser.add_option(rasterization_threads, "Paint on this many threads at once (only used with CPU painting)", "rasterization-threads", 0, "count");
     args_parser.add_option(echo_server_port_string_view, "Echo server port used in test internals", "echo-server-port", 0, "echo_server_port");
     args_parser.add_option(is_headless, "Report that the browser is running in headless mode", "headless");
     args_parser.add_option(default_time_zone, "Default time zone", "default-time-zone", 0, "time-zone-id");
@@ -152,6 +161,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     }
 
     Web::Painting::set_paint_viewport_scrollbars(!disable_scrollbar_painting);
+    Web::Painting::set_tile_rasterization_thread_count(rasterization_threads);
 
     if (!echo_server_port_string_view.is_empty()) {
         if (auto maybe_echo_server_port = echo_server_port_string_view.to_number<u16>(); maybe_echo_server_port.has_value())
@@ -193,6 +203,14 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
         Web::WebIDL::set_enable_idl_tracing(true);
     }
 
+    if (enable_style_recalc_tracing) {
+        Web::CSS::set_enable_style_recalc_tracing(true);
+    }
+
+    if (enable_rendering_phase_timings) {
+        Web::DOM::set_enable_rendering_phase_timings(true);
+    }
+
     auto maybe_content_filter_error = load_content_filters(config_path);
     if (maybe_content_filter_error.is_error())
         dbgln("Failed to load content filters: {}", maybe_content_filter_error.error());
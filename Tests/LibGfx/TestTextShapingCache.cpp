@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/MappedFile.h>
+#include <LibGfx/Font/Font.h>
+#include <LibGfx/Font/WOFF2/Loader.h>
+#include <LibGfx/TextLayout.h>
+#include <LibGfx/TextShapingCache.h>
+#include <LibTest/TestCase.h>
+
+#define TEST_INPUT(x) ("test-inputs/" x)
+
+static NonnullRefPtr<Gfx::Font> load_test_font(float point_size)
+{
+    auto file = MUST(Core::MappedFile::map(TEST_INPUT("woff2/incorrect_sfnt_size.woff2"sv)));
+    auto typeface = MUST(WOFF2::try_load_from_bytes(file->bytes()));
+    // NOTE: Fonts created through Typeface::font() are kept alive by the typeface, so we create an unshared one.
+    return adopt_ref(*new Gfx::Font(typeface, point_size, point_size));
+}
+
+static void reset_cache()
+{
+    auto& cache = Gfx::TextShapingCache::the();
+    cache.clear();
+    cache.reset_statistics();
+    cache.set_byte_budget(8 * MiB);
+}
+
+TEST_CASE(repeated_shaping_hits_the_cache)
+{
+    reset_cache();
+    auto& cache = Gfx::TextShapingCache::the();
+    auto font = load_test_font(16);
+    auto text = u"hello"sv;
+
+    auto first = cache.shape(text, *font, {});
+    auto second = cache.shape(text, *font, {});
+    EXPECT_EQ(first.ptr(), second.ptr());
+
+    auto statistics = cache.statistics();
+    EXPECT_EQ(statistics.misses, 1u);
+    EXPECT_EQ(statistics.hits, 1u);
+    EXPECT_EQ(statistics.entry_count, 1u);
+    EXPECT(statistics.byte_size > 0);
+}
+
+TEST_CASE(features_and_fonts_are_part_of_the_key)
+{
+    reset_cache();
+    auto& cache = Gfx::TextShapingCache::the();
+    auto font = load_test_font(16);
+    auto other_font = load_test_font(16);
+    auto text = u"hello"sv;
+
+    (void)cache.shape(text, *font, {});
+    (void)cache.shape(text, *font, { { { 'l', 'i', 'g', 'a' }, 0 } });
+    (void)cache.shape(text, *other_font, {});
+
+    auto statistics = cache.statistics();
+    EXPECT_EQ(statistics.misses, 3u);
+    EXPECT_EQ(statistics.hits, 0u);
+    EXPECT_EQ(statistics.entry_count, 3u);
+}
+
+TEST_CASE(least_recently_used_entries_are_evicted_over_budget)
+{
+    reset_cache();
+    auto& cache = Gfx::TextShapingCache::the();
+    auto font = load_test_font(16);
+
+    (void)cache.shape(u"a"sv, *font, {});
+    auto entry_size = cache.statistics().byte_size;
+    cache.set_byte_budget(entry_size * 2);
+
+    (void)cache.shape(u"b"sv, *font, {});
+    (void)cache.shape(u"a"sv, *font, {});
+    (void)cache.shape(u"c"sv, *font, {});
+
+    auto statistics = cache.statistics();
+    EXPECT_EQ(statistics.evictions, 1u);
+    EXPECT_EQ(statistics.entry_count, 2u);
+    EXPECT(statistics.byte_size <= statistics.byte_budget);
+
+    // "b" was the least recently used entry, so "a" must still be cached.
+    cache.reset_statistics();
+    (void)cache.shape(u"a"sv, *font, {});
+    EXPECT_EQ(cache.statistics().hits, 1u);
+    (void)cache.shape(u"b"sv, *font, {});
+    EXPECT_EQ(cache.statistics().misses, 1u);
+}
+
+TEST_CASE(destroyed_fonts_are_evicted)
+{
+    reset_cache();
+    auto& cache = Gfx::TextShapingCache::the();
+    {
+        auto font = load_test_font(16);
+        (void)cache.shape(u"hello"sv, *font, {});
+        EXPECT_EQ(cache.statistics().entry_count, 1u);
+    }
+    EXPECT_EQ(cache.statistics().entry_count, 0u);
+    EXPECT_EQ(cache.statistics().byte_size, 0u);
+}
+
+TEST_CASE(measured_width_matches_shaped_width)
+{
+    reset_cache();
+    auto font = load_test_font(16);
+    auto text = u"hello"sv;
+
+    auto glyph_run = Gfx::shape_text({}, 0, text, *font, Gfx::GlyphRun::TextType::Common, {});
+    EXPECT_APPROXIMATE(Gfx::measure_text_width(text, *font, {}), glyph_run->width());
+}
@@ -1473,3 +1473,130 @@ TEST_CASE(backreference_to_undefined_capture_groups)
         EXPECT(result2.capture_group_matches.first()[1].view.is_null());
     }
 }
+
+TEST_CASE(lazy_dfa_prefilter)
+{
+    {
+        Regex<ECMA262> re("(a+)+b"sv);
+        EXPECT(re.parser_result.optimization_data.can_use_lazy_dfa);
+
+        // Without the DFA rejecting this up front, the VM would explore every way of splitting up the 'a's.
+        auto subject = ByteString::repeated('a', 64);
+        EXPECT_EQ(re.match(subject.view()).success, false);
+
+        auto result = re.match("xxaaab"sv, ECMAScriptFlags::Global);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.first().view.to_byte_string(), "aaab"sv);
+        EXPECT_EQ(result.capture_group_matches.first()[0].view.to_byte_string(), "aaa"sv);
+    }
+
+    {
+        // Assertions and capture groups are ignored by the DFA, the VM still has the final say.
+        Regex<ECMA262> re("\\b(foo|bar)\\d*$"sv);
+        EXPECT(re.parser_result.optimization_data.can_use_lazy_dfa);
+        EXPECT_EQ(re.match("xfoo12"sv, ECMAScriptFlags::Global).success, false);
+        EXPECT_EQ(re.match("x foo12"sv, ECMAScriptFlags::Global).success, true);
+        EXPECT_EQ(re.match("x FOO12"sv, ECMAScriptFlags::Global).success, false);
+        EXPECT_EQ(re.match("x FOO12"sv, ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive).success, true);
+    }
+
+    {
+        // Backreferences and lookaround need the VM.
+        EXPECT(!Regex<ECMA262>("(a)\\1"sv).parser_result.optimization_data.can_use_lazy_dfa);
+        EXPECT(!Regex<ECMA262>("a(?=b)"sv).parser_result.optimization_data.can_use_lazy_dfa);
+    }
+}
+
+TEST_CASE(literal_prefix_search)
+{
+    {
+        Regex<ECMA262> re("(foo)\\d+"sv);
+        EXPECT_EQ(re.parser_result.optimization_data.literal_prefix.size(), 3u);
+
+        auto result = re.match("fo1 foo fooo42 xfoo7"sv, ECMAScriptFlags::Global);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.count, 1u);
+        EXPECT_EQ(result.matches.first().view.to_byte_string(), "foo7"sv);
+        EXPECT_EQ(result.matches.first().global_offset, 16u);
+    }
+
+    {
+        // The prefix is only taken up to the first fork.
+        Regex<ECMA262> re("ab?c"sv);
+        EXPECT_EQ(re.parser_result.optimization_data.literal_prefix.size(), 1u);
+        EXPECT_EQ(re.match("xxac abc"sv, ECMAScriptFlags::Global).count, 2u);
+    }
+
+    {
+        // Case-insensitive matching must not skip over differently-cased occurrences.
+        Regex<ECMA262> re("foo"sv, ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive);
+        EXPECT_EQ(re.match("xxFOO"sv).success, true);
+    }
+
+    {
+        // Lookbehind doesn't contribute to the prefix.
+        Regex<ECMA262> re("(?<=x)a"sv);
+        EXPECT(re.parser_result.optimization_data.literal_prefix.is_empty());
+    }
+}
+
+TEST_CASE(memoized_backtracking)
+{
+    {
+        // Unicode mode keeps the lazy DFA out of the way, so this exercises the VM alone.
+        Regex<ECMA262> re("(a|aa)*b"sv, ECMAScriptFlags::Unicode);
+        EXPECT(!re.parser_result.optimization_data.memoizable_forks.is_empty());
+
+        // Without memoization, this would take time exponential in the number of 'a's.
+        auto subject = ByteString::repeated('a', 64);
+        EXPECT_EQ(re.match(subject.view()).success, false);
+
+        auto result = re.match("aaab"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.first().view.to_byte_string(), "aaab"sv);
+        EXPECT_EQ(result.capture_group_matches.first()[0].view.to_byte_string(), "a"sv);
+    }
+
+    {
+        // Memoized failures must not leak into the search for the next match.
+        Regex<ECMA262> re("(x+x+)+y"sv, ECMAScriptFlags::Unicode | ECMAScriptFlags::Global);
+        auto subject = ByteString::formatted("{}y{}y", ByteString::repeated('x', 32), ByteString::repeated('x', 32));
+        auto result = re.match(subject.view());
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.count, 2u);
+    }
+
+    {
+        EXPECT(Regex<ECMA262>("(a)\\1"sv).parser_result.optimization_data.memoizable_forks.is_empty());
+        EXPECT(Regex<ECMA262>("(?=a)a"sv).parser_result.optimization_data.memoizable_forks.is_empty());
+    }
+}
+
+TEST_CASE(compiled_compares)
+{
+    Array tests {
+        // Pattern, Subject, Options, Expected match
+        Tuple { "[a-z_][a-z0-9_]*"sv, "  foo_42 = 1"sv, ECMAScriptOptions {}, "foo_42"sv },
+        Tuple { "[^\\s=]+"sv, "  foo_42 = 1"sv, ECMAScriptOptions {}, "foo_42"sv },
+        Tuple { "[A-Z]+"sv, "--HeLLo--"sv, ECMAScriptOptions { ECMAScriptFlags::Insensitive }, "HeLLo"sv },
+        Tuple { "\\w+\\d"sv, "__abc1"sv, ECMAScriptOptions {}, "__abc1"sv },
+        Tuple { "\\p{Lu}\\p{Ll}+"sv, "abcDef"sv, ECMAScriptOptions { ECMAScriptFlags::Unicode }, "Def"sv },
+        // Non-ASCII input goes through the interpreter.
+        Tuple { "[^a]+"sv, "aéèa"sv, ECMAScriptOptions {}, "éè"sv },
+        Tuple { "k+"sv, "xkK"sv, ECMAScriptOptions { ECMAScriptFlags::Unicode | ECMAScriptFlags::Insensitive }, "kK"sv },
+        Tuple { "."sv, "\n\r x"sv, ECMAScriptOptions {}, " "sv },
+    };
+
+    for (auto& test : tests) {
+        Regex<ECMA262> re(test.get<0>(), test.get<2>() | ECMAScriptFlags::Global);
+
+        // The compares are only compiled once the pattern is hot, so the interpreter is exercised first.
+        for (size_t i = 0; i <= regex::CompiledCompares::executions_before_compiling; ++i) {
+            EXPECT_EQ(re.matcher->compiled_compares().is_compiled(), i >= regex::CompiledCompares::executions_before_compiling);
+            auto result = re.match(test.get<1>());
+            EXPECT(result.success);
+            if (result.success)
+                EXPECT_EQ(result.matches.first().view.to_byte_string(), test.get<3>());
+        }
+    }
+}
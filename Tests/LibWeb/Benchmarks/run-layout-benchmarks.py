@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""
+This script loads every page in the benchmark corpus headlessly, collects the rendering phase timings of each load and
+reports them as JSON. Given a baseline produced by an earlier run, it also reports the phases and formatting context
+types that got slower, and exits with a non-zero status if any did.
+"""
+
+import argparse
+import json
+import statistics
+import subprocess
+import sys
+
+from pathlib import Path
+
+BENCHMARK_DIR = Path(__file__).resolve().parent
+PAGE_SUFFIXES = {".html", ".htm", ".xhtml", ".svg"}
+
+
+def find_pages(corpus_dirs: list[Path]) -> list[Path]:
+    pages = []
+    for corpus_dir in corpus_dirs:
+        pages.extend(path for path in corpus_dir.rglob("*") if path.suffix in PAGE_SUFFIXES)
+    return sorted(pages)
+
+
+def load_page(ladybird: str, page: Path, timeout: int) -> dict:
+    """
+    Load a page headlessly and return its rendering phase timings, summed over all of the page's updates.
+    """
+
+    process = subprocess.run(
+        [ladybird, "--headless=rendering-phase-timings", page.as_uri()],
+        check=True,
+        capture_output=True,
+        text=True,
+        timeout=timeout,
+    )
+
+    # The timings are printed as a single line of JSON, but other output may precede them.
+    timings = None
+    for line in reversed(process.stdout.splitlines()):
+        if line.startswith("{"):
+            timings = json.loads(line)
+            break
+    if timings is None:
+        raise RuntimeError(f"No rendering phase timings in output for {page}")
+    if timings.get("droppedUpdates", 0) > 0:
+        raise RuntimeError(f"Only the most recent rendering phase timings were kept for {page}")
+
+    totals = {"updates": len(timings["updates"]), "phases": {}, "formattingContexts": {}}
+    for update in timings["updates"]:
+        for kind in ["phases", "formattingContexts"]:
+            for name, timing in update[kind].items():
+                total = totals[kind].setdefault(name, {"runs": 0, "microseconds": 0})
+                total["runs"] += timing["runs"]
+                total["microseconds"] += timing["microseconds"]
+    return totals
+
+
+def summarize(samples: list[dict]) -> dict:
+    """
+    Reduce the timings of several loads of the same page to their medians.
+    """
+
+    summary = {"updates": samples[0]["updates"], "phases": {}, "formattingContexts": {}}
+    for kind in ["phases", "formattingContexts"]:
+        names = sorted({name for sample in samples for name in sample[kind]})
+        for name in names:
+            timings = [sample[kind].get(name, {"runs": 0, "microseconds": 0}) for sample in samples]
+            summary[kind][name] = {
+                "runs": timings[0]["runs"],
+                "medianMicroseconds": statistics.median(timing["microseconds"] for timing in timings),
+                "minMicroseconds": min(timing["microseconds"] for timing in timings),
+            }
+    return summary
+
+
+def find_regressions(results: dict, baseline: dict, threshold: float, min_microseconds: int) -> list[str]:
+    """
+    Compare the median times against a baseline. Times below min_microseconds are too noisy to compare.
+    """
+
+    regressions = []
+    for page, summary in results.items():
+        if page not in baseline:
+            continue
+        for kind in ["phases", "formattingContexts"]:
+            for name, timing in summary[kind].items():
+                baseline_timing = baseline[page][kind].get(name)
+                if baseline_timing is None:
+                    continue
+                before = baseline_timing["medianMicroseconds"]
+                after = timing["medianMicroseconds"]
+                if max(before, after) < min_microseconds:
+                    continue
+                if after > before * (1 + threshold / 100):
+                    change = (after / before - 1) * 100 if before else float("inf")
+                    regressions.append(f"{page}: {kind}.{name} went from {before}µs to {after}µs (+{change:.1f}%)")
+    return regressions
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Run the layout benchmark corpus and report timings as JSON")
+    parser.add_argument("--ladybird", required=True, help="Path to the Ladybird executable")
+    parser.add_argument(
+        "--corpus",
+        action="append",
+        type=Path,
+        help="Directory of pages to load, may be given multiple times (default: the Layout directory next to this script)",
+    )
+    parser.add_argument("--iterations", type=int, default=5, help="How many times to load each page (default: 5)")
+    parser.add_argument("--timeout", type=int, default=60, help="Timeout per page load in seconds (default: 60)")
+    parser.add_argument("--output", type=Path, help="Write the results to this file instead of stdout")
+    parser.add_argument("--baseline", type=Path, help="Results of an earlier run to compare against")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=10,
+        help="How many percent slower than the baseline counts as a regression (default: 10)",
+    )
+    parser.add_argument(
+        "--min-microseconds",
+        type=int,
+        default=500,
+        help="Ignore timings below this many microseconds when comparing (default: 500)",
+    )
+    args = parser.parse_args()
+
+    corpus_dirs = args.corpus or [BENCHMARK_DIR / "Layout"]
+    pages = find_pages(corpus_dirs)
+    if not pages:
+        print("No benchmark pages found", file=sys.stderr)
+        return 1
+
+    results = {}
+    for page in pages:
+        name = str(page.relative_to(BENCHMARK_DIR)) if page.is_relative_to(BENCHMARK_DIR) else str(page)
+        print(f"Running {name}...", file=sys.stderr)
+        samples = [load_page(args.ladybird, page, args.timeout) for _ in range(args.iterations)]
+        results[name] = summarize(samples)
+
+    output = json.dumps(results, indent=4, sort_keys=True)
+    if args.output:
+        args.output.write_text(output + "\n")
+    else:
+        print(output)
+
+    if args.baseline:
+        baseline = json.loads(args.baseline.read_text())
+        regressions = find_regressions(results, baseline, args.threshold, args.min_microseconds)
+        for regression in regressions:
+            print(f"Regression: {regression}", file=sys.stderr)
+        if regressions:
+            return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
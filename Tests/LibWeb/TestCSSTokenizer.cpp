@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/FlyString.h>
+#include <AK/Vector.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/CSS/Parser/Tokenizer.h>
+
+namespace Web::CSS::Parser {
+
+static Vector<Token> tokenize(StringView input)
+{
+    return Tokenizer::tokenize(input, "utf-8"sv);
+}
+
+TEST_CASE(whitespace_and_idents)
+{
+    auto tokens = tokenize("    \n\t   foo-bar_baz-with-a-rather-long-name       \n\n   x"sv);
+    EXPECT_EQ(tokens.size(), 5u);
+
+    EXPECT(tokens[0].is(Token::Type::Whitespace));
+    EXPECT_EQ(tokens[0].end_position().line, 1u);
+    EXPECT_EQ(tokens[0].end_position().column, 4u);
+
+    EXPECT(tokens[1].is(Token::Type::Ident));
+    EXPECT_EQ(tokens[1].ident(), "foo-bar_baz-with-a-rather-long-name"_fly_string);
+    EXPECT_EQ(tokens[1].start_position().line, 1u);
+    EXPECT_EQ(tokens[1].start_position().column, 4u);
+    EXPECT_EQ(tokens[1].end_position().column, 39u);
+
+    EXPECT(tokens[2].is(Token::Type::Whitespace));
+    EXPECT_EQ(tokens[2].end_position().line, 3u);
+    EXPECT_EQ(tokens[2].end_position().column, 3u);
+
+    EXPECT(tokens[3].is(Token::Type::Ident));
+    EXPECT_EQ(tokens[3].ident(), "x"_fly_string);
+    EXPECT(tokens[4].is(Token::Type::EndOfFile));
+}
+
+TEST_CASE(non_ascii_idents)
+{
+    auto tokens = tokenize("héllo-wörld-ünïcödé-ïdéntïfïér;"sv);
+    EXPECT_EQ(tokens.size(), 3u);
+    EXPECT(tokens[0].is(Token::Type::Ident));
+    EXPECT_EQ(tokens[0].ident(), "héllo-wörld-ünïcödé-ïdéntïfïér"_fly_string);
+    EXPECT_EQ(tokens[0].end_position().column, 30u);
+    EXPECT(tokens[1].is(Token::Type::Semicolon));
+}
+
+TEST_CASE(idents_with_escapes)
+{
+    auto tokens = tokenize("abcdefghijklmnopqrstu\\41 xyz abcdefghijklmnopqrstu\\\n"sv);
+    EXPECT_EQ(tokens.size(), 6u);
+    EXPECT(tokens[0].is(Token::Type::Ident));
+    EXPECT_EQ(tokens[0].ident(), "abcdefghijklmnopqrstuAxyz"_fly_string);
+    EXPECT(tokens[1].is(Token::Type::Whitespace));
+    EXPECT(tokens[2].is(Token::Type::Ident));
+    EXPECT_EQ(tokens[2].ident(), "abcdefghijklmnopqrstu"_fly_string);
+    EXPECT(tokens[3].is(Token::Type::Delim));
+    EXPECT(tokens[4].is(Token::Type::Whitespace));
+}
+
+TEST_CASE(strings)
+{
+    auto tokens = tokenize("\"a long string without any escapes\" 'a \\\"quoted\\\" string that is long' \"unterminated string\n"sv);
+    EXPECT_EQ(tokens.size(), 7u);
+    EXPECT(tokens[0].is(Token::Type::String));
+    EXPECT_EQ(tokens[0].string(), "a long string without any escapes"_fly_string);
+    EXPECT_EQ(tokens[0].original_source_text(), "\"a long string without any escapes\""sv);
+    EXPECT(tokens[2].is(Token::Type::String));
+    EXPECT_EQ(tokens[2].string(), "a \"quoted\" string that is long"_fly_string);
+    EXPECT(tokens[4].is(Token::Type::BadString));
+    EXPECT(tokens[5].is(Token::Type::Whitespace));
+}
+
+TEST_CASE(urls)
+{
+    auto tokens = tokenize("url(  https://example.com/some/long/path/image.png  ) url(abcdefghijklmnop\\29 qrs) url(abcdefghijklmnop\"qrs)"sv);
+    EXPECT_EQ(tokens.size(), 6u);
+    EXPECT(tokens[0].is(Token::Type::Url));
+    EXPECT_EQ(tokens[0].url(), "https://example.com/some/long/path/image.png"_fly_string);
+    EXPECT(tokens[2].is(Token::Type::Url));
+    EXPECT_EQ(tokens[2].url(), "abcdefghijklmnop)qrs"_fly_string);
+    EXPECT(tokens[4].is(Token::Type::BadUrl));
+}
+
+TEST_CASE(comments)
+{
+    auto tokens = tokenize("/* a comment that is longer than sixteen bytes,\n  spanning ** two lines */a"sv);
+    EXPECT_EQ(tokens.size(), 3u);
+    EXPECT(tokens[0].is(Token::Type::Whitespace));
+    EXPECT(tokens[1].is(Token::Type::Ident));
+    EXPECT_EQ(tokens[1].ident(), "a"_fly_string);
+    EXPECT_EQ(tokens[1].start_position().line, 1u);
+    EXPECT_EQ(tokens[1].start_position().column, 26u);
+}
+
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestPaintingCommon.h"
+#include <AK/Array.h>
+#include <LibWeb/Painting/DisplayListSpatialIndex.h>
+#include <LibWeb/Painting/ScrollState.h>
+
+namespace Web::Painting {
+
+static constexpr int row_height = 20;
+static constexpr int row_count = 5000;
+
+static Color color_for_row(int row)
+{
+    return Color(row % 256, (row / 256) % 256, 100);
+}
+
+// Records a long page made of many thin rows, optionally painted in a scroll frame.
+// If rows_between_saves is given, a save and a restore are recorded every so many rows, which keeps the runs of
+// painting commands too short to be indexed without changing what is painted.
+static NonnullRefPtr<DisplayList> record_long_page(Optional<i32> scroll_frame_id = {}, Optional<int> rows_between_saves = {})
+{
+    return record_display_list([&](DisplayListRecorder& recorder) {
+        recorder.push_scroll_frame_id(scroll_frame_id);
+        recorder.fill_rect({ 0, 0, 100, row_count * row_height }, Color::White);
+        for (int row = 0; row < row_count; ++row) {
+            if (rows_between_saves.has_value() && row % rows_between_saves.value() == 0) {
+                recorder.save();
+                recorder.restore();
+            }
+            recorder.fill_rect({ 0, row * row_height, 100, row_height }, color_for_row(row));
+        }
+        recorder.pop_scroll_frame_id();
+    });
+}
+
+static NonnullRefPtr<Gfx::Bitmap> paint_tile(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, Gfx::IntRect const& tile_rect)
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, tile_rect.size()));
+    ScrollStateSnapshotByDisplayList scroll_state_snapshot_by_display_list;
+    scroll_state_snapshot_by_display_list.set(display_list, scroll_state);
+    DisplayListPlayerSkia player;
+    player.execute_tile(display_list, move(scroll_state_snapshot_by_display_list), Gfx::PaintingSurface::wrap_bitmap(*bitmap), tile_rect);
+    return bitmap;
+}
+
+TEST_CASE(long_display_lists_are_indexed)
+{
+    auto display_list = record_long_page();
+    auto const* spatial_index = display_list->spatial_index();
+    EXPECT(spatial_index);
+    EXPECT_EQ(spatial_index->runs().size(), 1u);
+
+    auto short_display_list = DisplayList::create(1);
+    {
+        DisplayListRecorder recorder(short_display_list);
+        recorder.fill_rect({ 0, 0, 100, 100 }, Color::White);
+    }
+    EXPECT(!short_display_list->spatial_index());
+}
+
+TEST_CASE(finds_only_commands_intersecting_rect)
+{
+    auto display_list = record_long_page();
+    auto const& run = display_list->spatial_index()->runs()[0];
+
+    Vector<size_t> command_indices;
+    display_list->spatial_index()->find_commands_intersecting(run, { 0, 1000 * row_height, 100, 3 * row_height }, {}, 1, command_indices);
+
+    // The page background, plus the rows the rect overlaps or touches once inflated a little.
+    EXPECT(command_indices.size() >= 4u);
+    EXPECT(command_indices.size() <= 6u);
+    for (size_t i = 1; i < command_indices.size(); ++i)
+        EXPECT(command_indices[i - 1] > command_indices[i]);
+    EXPECT_EQ(command_indices.last(), run.start);
+    EXPECT(command_indices.contains_slow(run.start + 1 + 1000));
+    EXPECT(command_indices.contains_slow(run.start + 1 + 1002));
+}
+
+TEST_CASE(painting_part_of_long_page_uses_index)
+{
+    auto display_list = record_long_page();
+
+    Gfx::IntRect const tile_rect { 0, 2500 * row_height, 100, 10 * row_height };
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, tile_rect.size()));
+    DisplayListPlayerSkia player;
+    player.execute_tile(display_list, {}, Gfx::PaintingSurface::wrap_bitmap(*bitmap), tile_rect);
+
+    for (int row = 0; row < 10; ++row)
+        EXPECT_EQ(bitmap->get_pixel(50, row * row_height + row_height / 2), color_for_row(2500 + row));
+}
+
+TEST_CASE(painting_part_of_scrolled_long_page_uses_index)
+{
+    auto display_list = record_long_page(0);
+    EXPECT(display_list->spatial_index());
+    auto unindexed_display_list = record_long_page(0, 32);
+    EXPECT(!unindexed_display_list->spatial_index());
+
+    // Scrolled down by 1000 rows and a half, so the tile starts in the middle of a row.
+    Array<CSSPixelPoint, 1> offsets { CSSPixelPoint { 0, -(1000 * row_height + row_height / 2) } };
+    auto scroll_state = ScrollStateSnapshot::create_with_offsets(offsets);
+
+    Gfx::IntRect const tile_rect { 0, 2500 * row_height, 100, 10 * row_height };
+    auto bitmap = paint_tile(display_list, scroll_state, tile_rect);
+    auto expected = paint_tile(unindexed_display_list, scroll_state, tile_rect);
+
+    expect_same_pixels(*bitmap, *expected);
+    EXPECT_EQ(bitmap->get_pixel(50, row_height), color_for_row(3501));
+}
+
+}
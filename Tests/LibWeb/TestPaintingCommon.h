@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/DisplayListRecorder.h>
+
+namespace Web::Painting {
+
+template<typename Callback>
+static inline NonnullRefPtr<DisplayList> record_display_list(Callback callback)
+{
+    auto display_list = DisplayList::create(1);
+    {
+        DisplayListRecorder recorder(display_list);
+        callback(recorder);
+    }
+    return display_list;
+}
+
+static inline NonnullRefPtr<Gfx::Bitmap> paint_display_list(DisplayListPlayerSkia& player, DisplayList& display_list, Gfx::IntSize size)
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, size));
+    player.execute(display_list, {}, Gfx::PaintingSurface::wrap_bitmap(*bitmap));
+    return bitmap;
+}
+
+static inline NonnullRefPtr<Gfx::Bitmap> paint_display_list(DisplayList& display_list, Gfx::IntSize size)
+{
+    DisplayListPlayerSkia player;
+    return paint_display_list(player, display_list, size);
+}
+
+static inline void expect_same_pixels(Gfx::Bitmap const& a, Gfx::Bitmap const& b)
+{
+    EXPECT_EQ(a.size(), b.size());
+    for (int y = 0; y < a.height(); ++y) {
+        for (int x = 0; x < a.width(); ++x) {
+            if (a.get_pixel(x, y) != b.get_pixel(x, y)) {
+                FAIL(ByteString::formatted("Pixel at {},{} differs", x, y));
+                return;
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestPaintingCommon.h"
+#include <AK/Array.h>
+#include <LibGfx/ImmutableBitmap.h>
+
+namespace Web::Painting {
+
+static constexpr Gfx::IntSize surface_size { 200, 200 };
+
+static void push_animated_stacking_context(DisplayListRecorder& recorder, float opacity, int translate_x)
+{
+    auto matrix = Gfx::FloatMatrix4x4::identity();
+    matrix[0, 3] = translate_x;
+
+    recorder.push_stacking_context({
+        .opacity = opacity,
+        .compositing_and_blending_operator = Gfx::CompositingAndBlendingOperator::Normal,
+        .isolate = false,
+        .transform = StackingContextTransform({ 50, 50 }, matrix, {}, 1),
+    });
+}
+
+static NonnullRefPtr<DisplayList> record_frame(float opacity, int translate_x, Color content_color)
+{
+    return record_display_list([&](DisplayListRecorder& recorder) {
+        recorder.fill_rect({ {}, surface_size }, Color::White);
+        push_animated_stacking_context(recorder, opacity, translate_x);
+        recorder.fill_rect({ 20, 20, 60, 60 }, content_color);
+        recorder.fill_rect_with_rounded_corners({ 40, 40, 60, 60 }, Color::Blue, 10);
+        recorder.pop_stacking_context();
+    });
+}
+
+static NonnullRefPtr<DisplayList> record_frame_with_bitmap(float opacity, Gfx::ImmutableBitmap const& bitmap)
+{
+    return record_display_list([&](DisplayListRecorder& recorder) {
+        recorder.fill_rect({ {}, surface_size }, Color::White);
+        push_animated_stacking_context(recorder, opacity, 0);
+        recorder.draw_scaled_immutable_bitmap({ 20, 20, 60, 60 }, { 20, 20, 60, 60 }, bitmap);
+        recorder.pop_stacking_context();
+    });
+}
+
+static NonnullRefPtr<Gfx::ImmutableBitmap> create_bitmap(Color color)
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, { 60, 60 }));
+    for (int y = 0; y < bitmap->height(); ++y) {
+        for (int x = 0; x < bitmap->width(); ++x)
+            bitmap->set_pixel(x, y, color);
+    }
+    return Gfx::ImmutableBitmap::create(bitmap);
+}
+
+TEST_CASE(animating_opacity_composites_cached_contents)
+{
+    DisplayListPlayerSkia player;
+    for (auto opacity : { 0.2f, 0.4f, 0.6f, 0.8f }) {
+        auto frame = record_frame(opacity, 0, Color::Red);
+        expect_same_pixels(*paint_display_list(player, frame, surface_size), *paint_display_list(frame, surface_size));
+    }
+    EXPECT(player.cached_layer_reuse_count() > 0);
+}
+
+TEST_CASE(animating_translation_composites_cached_contents)
+{
+    DisplayListPlayerSkia player;
+    for (auto translate_x : { 0, 10, 20, 30 }) {
+        auto frame = record_frame(0.5f, translate_x, Color::Red);
+        expect_same_pixels(*paint_display_list(player, frame, surface_size), *paint_display_list(frame, surface_size));
+    }
+    EXPECT(player.cached_layer_reuse_count() > 0);
+}
+
+TEST_CASE(painting_several_rects_composites_cached_contents)
+{
+    DisplayListPlayerSkia player;
+    Array<Gfx::IntRect, 2> rects { Gfx::IntRect { 0, 0, 200, 60 }, Gfx::IntRect { 0, 60, 200, 140 } };
+    for (auto opacity : { 0.2f, 0.4f, 0.6f, 0.8f }) {
+        auto frame = record_frame(opacity, 0, Color::Red);
+        auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, surface_size));
+        player.execute_in_rects(frame, {}, Gfx::PaintingSurface::wrap_bitmap(*bitmap), rects);
+        expect_same_pixels(*bitmap, *paint_display_list(frame, surface_size));
+    }
+    EXPECT(player.cached_layer_reuse_count() > 0);
+}
+
+TEST_CASE(unchanging_stacking_contexts_are_not_cached)
+{
+    DisplayListPlayerSkia player;
+    for (int i = 0; i < 4; ++i)
+        (void)paint_display_list(player, record_frame(0.5f, 0, Color::Red), surface_size);
+    EXPECT_EQ(player.cached_layer_reuse_count(), 0u);
+}
+
+TEST_CASE(changed_contents_are_rasterized_again)
+{
+    DisplayListPlayerSkia player;
+    (void)paint_display_list(player, record_frame(0.5f, 0, Color::Red), surface_size);
+    (void)paint_display_list(player, record_frame(0.6f, 0, Color::Red), surface_size);
+
+    auto reuse_count = player.cached_layer_reuse_count();
+    auto frame = record_frame(0.7f, 0, Color::Green);
+    expect_same_pixels(*paint_display_list(player, frame, surface_size), *paint_display_list(frame, surface_size));
+    EXPECT_EQ(player.cached_layer_reuse_count(), reuse_count);
+}
+
+TEST_CASE(changed_bitmap_contents_are_rasterized_again)
+{
+    DisplayListPlayerSkia player;
+    {
+        auto red_bitmap = create_bitmap(Color::Red);
+        for (auto opacity : { 0.2f, 0.4f, 0.6f, 0.8f })
+            (void)paint_display_list(player, record_frame_with_bitmap(opacity, red_bitmap), surface_size);
+    }
+
+    // NOTE: Unless the player keeps the red bitmap alive for its cached layer, the green bitmap may well be allocated at
+    //       the same address now that the frames it was painted in are gone.
+    auto green_bitmap = create_bitmap(Color::Green);
+    auto frame = record_frame_with_bitmap(0.5f, green_bitmap);
+    expect_same_pixels(*paint_display_list(player, frame, surface_size), *paint_display_list(frame, surface_size));
+}
+
+}
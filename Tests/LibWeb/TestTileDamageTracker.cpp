@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/DisplayListRecorder.h>
+#include <LibWeb/Painting/TileDamageTracker.h>
+
+namespace Web::Painting {
+
+static constexpr int tile_size = TileDamageTracker::tile_size;
+static constexpr Gfx::IntSize surface_size { 4 * tile_size, 3 * tile_size };
+
+static NonnullRefPtr<Gfx::PaintingSurface> create_surface()
+{
+    return Gfx::PaintingSurface::create_with_size(nullptr, surface_size, Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied);
+}
+
+static NonnullRefPtr<DisplayList> record_square(Gfx::IntRect square_rect, Color square_color)
+{
+    auto display_list = DisplayList::create(1);
+    {
+        DisplayListRecorder recorder(display_list);
+        recorder.fill_rect({ {}, surface_size }, Color::White);
+        recorder.fill_rect(square_rect, square_color);
+    }
+    return display_list;
+}
+
+TEST_CASE(first_paint_damages_whole_surface)
+{
+    TileDamageTracker tracker;
+    auto surface = create_surface();
+    auto damage = tracker.compute_damage(surface, record_square({ 10, 10, 20, 20 }, Color::Red), {});
+    EXPECT_EQ(damage.size(), 1u);
+    EXPECT_EQ(damage[0], Gfx::IntRect({}, surface_size));
+}
+
+TEST_CASE(unchanged_display_list_causes_no_damage)
+{
+    TileDamageTracker tracker;
+    auto surface = create_surface();
+    (void)tracker.compute_damage(surface, record_square({ 10, 10, 20, 20 }, Color::Red), {});
+    auto damage = tracker.compute_damage(surface, record_square({ 10, 10, 20, 20 }, Color::Red), {});
+    EXPECT(damage.is_empty());
+}
+
+TEST_CASE(changed_command_damages_only_its_tiles)
+{
+    TileDamageTracker tracker;
+    auto surface = create_surface();
+    (void)tracker.compute_damage(surface, record_square({ 300, 300, 20, 20 }, Color::Red), {});
+
+    auto damage = tracker.compute_damage(surface, record_square({ 300, 300, 20, 20 }, Color::Blue), {});
+    EXPECT_EQ(damage.size(), 1u);
+    EXPECT_EQ(damage[0], Gfx::IntRect(tile_size, tile_size, tile_size, tile_size));
+
+    // Moving the square damages both where it was and where it is now.
+    damage = tracker.compute_damage(surface, record_square({ 10, 10, 20, 20 }, Color::Blue), {});
+    EXPECT_EQ(damage.size(), 2u);
+    EXPECT_EQ(damage[0], Gfx::IntRect(0, 0, tile_size, tile_size));
+    EXPECT_EQ(damage[1], Gfx::IntRect(tile_size, tile_size, tile_size, tile_size));
+}
+
+TEST_CASE(damage_is_tracked_per_surface)
+{
+    TileDamageTracker tracker;
+    auto front = create_surface();
+    auto back = create_surface();
+    (void)tracker.compute_damage(front, record_square({ 10, 10, 20, 20 }, Color::Red), {});
+    (void)tracker.compute_damage(back, record_square({ 10, 10, 20, 20 }, Color::Red), {});
+
+    auto damage = tracker.compute_damage(front, record_square({ 10, 10, 20, 20 }, Color::Blue), {});
+    EXPECT_EQ(damage.size(), 1u);
+
+    // The other buffer still shows the red square, so it has to be repainted even though the frame didn't change.
+    damage = tracker.compute_damage(back, record_square({ 10, 10, 20, 20 }, Color::Blue), {});
+    EXPECT_EQ(damage.size(), 1u);
+    EXPECT_EQ(damage[0], Gfx::IntRect(0, 0, tile_size, tile_size));
+
+    damage = tracker.compute_damage(front, record_square({ 10, 10, 20, 20 }, Color::Blue), {});
+    EXPECT(damage.is_empty());
+}
+
+TEST_CASE(transformed_content_damages_whole_surface)
+{
+    auto record = [](Color color) {
+        auto display_list = DisplayList::create(1);
+        {
+            DisplayListRecorder recorder(display_list);
+            recorder.fill_rect({ {}, surface_size }, Color::White);
+            recorder.save();
+            recorder.translate({ 500, 500 });
+            recorder.fill_rect({ 10, 10, 20, 20 }, color);
+            recorder.restore();
+        }
+        return display_list;
+    };
+
+    TileDamageTracker tracker;
+    auto surface = create_surface();
+    (void)tracker.compute_damage(surface, record(Color::Red), {});
+    auto damage = tracker.compute_damage(surface, record(Color::Blue), {});
+    EXPECT_EQ(damage.size(), 1u);
+    EXPECT_EQ(damage[0], Gfx::IntRect({}, surface_size));
+}
+
+TEST_CASE(repainting_damage_matches_full_repaint)
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, surface_size));
+    auto surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
+    TileDamageTracker tracker;
+    DisplayListPlayerSkia player;
+
+    auto first_frame = record_square({ 10, 10, 20, 20 }, Color::Red);
+    player.execute_in_rects(first_frame, {}, surface, tracker.compute_damage(surface, first_frame, {}));
+
+    auto second_frame = record_square({ 300, 300, 20, 20 }, Color::Blue);
+    player.execute_in_rects(second_frame, {}, surface, tracker.compute_damage(surface, second_frame, {}));
+
+    EXPECT_EQ(bitmap->get_pixel(15, 15), Color::White);
+    EXPECT_EQ(bitmap->get_pixel(305, 305), Color::Blue);
+    EXPECT_EQ(bitmap->get_pixel(600, 600), Color::White);
+}
+
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestPaintingCommon.h"
+#include <AK/Array.h>
+#include <LibWeb/Painting/TileDamageTracker.h>
+#include <LibWeb/Painting/TileRasterizer.h>
+
+namespace Web::Painting {
+
+static constexpr int tile_size = TileDamageTracker::tile_size;
+static constexpr Gfx::IntSize surface_size { 3 * tile_size + 50, 5 * tile_size + 20 };
+
+static NonnullRefPtr<DisplayList> record_page()
+{
+    return record_display_list([](DisplayListRecorder& recorder) {
+        recorder.fill_rect({ {}, surface_size }, Color::White);
+        for (int i = 0; i < 12; ++i)
+            recorder.fill_rect_with_rounded_corners({ 40 + i * 30, 60 + i * 90, 300, 120 }, Color(i * 20, 100, 255 - i * 20), 16);
+        recorder.save();
+        recorder.translate({ tile_size - 10, 3 * tile_size - 10 });
+        recorder.fill_rect({ 0, 0, 20, 20 }, Color::Red);
+        recorder.restore();
+    });
+}
+
+TEST_CASE(rasterizing_tiles_matches_serial_painting)
+{
+    auto display_list = record_page();
+    auto expected = paint_display_list(display_list, surface_size);
+
+    auto rasterizer = MUST(TileRasterizer::create(4));
+    EXPECT(TileRasterizer::can_rasterize(display_list));
+
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, surface_size));
+    auto surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
+    Gfx::IntRect whole_surface { {}, surface_size };
+    EXPECT(rasterizer->rasterize(display_list, {}, surface, { &whole_surface, 1 }));
+    expect_same_pixels(*expected, *bitmap);
+}
+
+TEST_CASE(rasterizing_only_some_rects)
+{
+    auto display_list = record_page();
+    auto expected = paint_display_list(display_list, surface_size);
+
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, surface_size));
+    for (int y = 0; y < bitmap->height(); ++y) {
+        for (int x = 0; x < bitmap->width(); ++x)
+            bitmap->set_pixel(x, y, Color::Black);
+    }
+    auto surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
+
+    auto rasterizer = MUST(TileRasterizer::create(2));
+    Array<Gfx::IntRect, 2> rects { Gfx::IntRect { 0, tile_size, 2 * tile_size, tile_size }, Gfx::IntRect { 0, 3 * tile_size, surface_size.width(), 2 * tile_size } };
+    EXPECT(rasterizer->rasterize(display_list, {}, surface, rects));
+
+    for (auto const& rect : rects) {
+        for (int y = rect.top(); y < rect.bottom(); ++y) {
+            for (int x = rect.left(); x < rect.right(); ++x)
+                EXPECT_EQ(bitmap->get_pixel(x, y), expected->get_pixel(x, y));
+        }
+    }
+    EXPECT_EQ(bitmap->get_pixel(5, 5), Color::Black);
+}
+
+TEST_CASE(canvases_are_not_rasterized_on_several_threads)
+{
+    auto canvas = Gfx::PaintingSurface::create_with_size(nullptr, { 10, 10 }, Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied);
+    auto display_list = DisplayList::create(1);
+    {
+        DisplayListRecorder recorder(display_list);
+        recorder.draw_painting_surface({ 0, 0, 10, 10 }, canvas, { 0, 0, 10, 10 });
+    }
+    EXPECT(!TileRasterizer::can_rasterize(display_list));
+}
+
+}